@@ -8,43 +8,73 @@
 
 UObject* UDefaultInstanceFactory::Create(UObject* Outer, UClass* EffectiveClass) const
 {
-    UWorld* World = Outer->GetWorld();
-
     if (EffectiveClass->IsChildOf<AActor>())
     {
-        checkf(World != nullptr, TEXT("Cannot retrieve World from container. Make sure you provided valid Outer to FObjectContainerBuilder::Build"));
-
-        return World->SpawnActorDeferred<AActor>(EffectiveClass, FTransform::Identity);
+        return SpawnActorDeferred(Outer, EffectiveClass);
     }
 
     if (EffectiveClass->IsChildOf<UUserWidget>())
     {
-        checkf(World != nullptr, TEXT("Cannot retrieve World from container. Make sure you provided valid Outer to FObjectContainerBuilder::Build"));
+        return CreateUserWidget(Outer, EffectiveClass);
+    }
+
+    return CreateObject(Outer, EffectiveClass);
+}
+
+void UDefaultInstanceFactory::FinalizeCreation(UObject* Object) const
+{
+    if (AActor* Actor = Cast<AActor>(Object))
+    {
+        FinishSpawning(*Actor);
+    }
+}
 
-        return CreateWidget<UUserWidget>(World, EffectiveClass);
+UObject* UDefaultInstanceFactory::CreateAt(UObject* Outer, UClass* EffectiveClass, const FTransform& Transform) const
+{
+    if (EffectiveClass->IsChildOf<AActor>())
+    {
+        return SpawnActorDeferred(Outer, EffectiveClass, Transform);
     }
 
+    return Create(Outer, EffectiveClass);
+}
+
+AActor* UDefaultInstanceFactory::SpawnActorDeferred(UObject* Outer, UClass* ActorClass, const FTransform& Transform)
+{
+    UWorld* World = Outer->GetWorld();
+    checkf(World != nullptr, TEXT("Cannot retrieve World from container. Make sure you provided valid Outer to FObjectContainerBuilder::Build"));
+
+    return World->SpawnActorDeferred<AActor>(ActorClass, Transform);
+}
+
+void UDefaultInstanceFactory::FinishSpawning(AActor& Actor, const FTransform& Transform)
+{
+    Actor.FinishSpawning(Transform);
+}
+
+UUserWidget* UDefaultInstanceFactory::CreateUserWidget(UObject* Outer, UClass* WidgetClass)
+{
+    UWorld* World = Outer->GetWorld();
+    checkf(World != nullptr, TEXT("Cannot retrieve World from container. Make sure you provided valid Outer to FObjectContainerBuilder::Build"));
+
+    return CreateWidget<UUserWidget>(World, WidgetClass);
+}
+
+UObject* UDefaultInstanceFactory::CreateObject(UObject* Outer, UClass* ObjectClass)
+{
     // try to create objects with stable names if possible
-    FName NewObjectName = EffectiveClass->GetFName();
+    FName NewObjectName = ObjectClass->GetFName();
 
 #if UE_VERSION_OLDER_THAN(5,5,0)
-    UObject* ExistingObject = StaticFindObjectFastInternal(EffectiveClass, Outer, NewObjectName, true, RF_NoFlags, IsInAsyncLoadingThread() ? EInternalObjectFlags::None : EInternalObjectFlags::AsyncLoading);
+    UObject* ExistingObject = StaticFindObjectFastInternal(ObjectClass, Outer, NewObjectName, true, RF_NoFlags, IsInAsyncLoadingThread() ? EInternalObjectFlags::None : EInternalObjectFlags::AsyncLoading);
 #else
-    UObject* ExistingObject = StaticFindObjectFastInternal(EffectiveClass, Outer, NewObjectName, true, RF_NoFlags, IsInAsyncLoadingThread() ? EInternalObjectFlags::None : EInternalObjectFlags_AsyncLoading);
+    UObject* ExistingObject = StaticFindObjectFastInternal(ObjectClass, Outer, NewObjectName, true, RF_NoFlags, IsInAsyncLoadingThread() ? EInternalObjectFlags::None : EInternalObjectFlags_AsyncLoading);
 #endif
     if (ExistingObject != nullptr)
     {
         // object with this name already exists, fallback to unique name
-        NewObjectName = MakeUniqueObjectName(Outer, EffectiveClass, NewObjectName);
+        NewObjectName = MakeUniqueObjectName(Outer, ObjectClass, NewObjectName);
     }
 
-    return NewObject<UObject>(Outer, EffectiveClass, NewObjectName);
-}
-
-void UDefaultInstanceFactory::FinalizeCreation(UObject* Object) const
-{
-    if (AActor* Actor = Cast<AActor>(Object))
-    {
-        Actor->FinishSpawning(FTransform::Identity);
-    }
+    return NewObject<UObject>(Outer, ObjectClass, NewObjectName);
 }
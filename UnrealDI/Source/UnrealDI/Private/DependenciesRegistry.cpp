@@ -1,6 +1,8 @@
 // Copyright Andrei Sudarikov. All Rights Reserved.
 
 #include "DI/Impl/DependenciesRegistry.h"
+#include "Components/ActorComponent.h"
+#include "UObject/UnrealType.h"
 
 void UnrealDI_Impl::FDependenciesRegistry::Init()
 {
@@ -30,6 +32,22 @@ void UnrealDI_Impl::FDependenciesRegistry::ProcessPendingRegistrations()
 
         UnprocessedEntries.Empty();
     }
+
+    TArray<FUnprocessedPropertiesEntry>& UnprocessedPropertiesEntries = GetUnprocessedPropertiesEntries();
+    if (UnprocessedPropertiesEntries.Num() > 0)
+    {
+        for (const FUnprocessedPropertiesEntry& Entry : UnprocessedPropertiesEntries)
+        {
+            TArray<FName>& PropertyNames = NativeInjectedProperties.Add(Entry.ClassGetter());
+
+            for (const TCHAR* PropertyName : Entry.PropertyNames)
+            {
+                PropertyNames.Add(PropertyName);
+            }
+        }
+
+        UnprocessedPropertiesEntries.Empty();
+    }
 }
 
 void UnrealDI_Impl::FDependenciesRegistry::ClearBlueprintInitFunctionsCache()
@@ -48,9 +66,33 @@ void UnrealDI_Impl::FDependenciesRegistry::ClearBlueprintInitFunctionsCache()
             It.RemoveCurrent();
         }
     }
+
+    // blueprint recompilation may change default subobjects of native classes too, so drop the whole cache
+    CachedInjectableSubobjects.Empty();
 }
 
 void UnrealDI_Impl::FDependenciesRegistry::FindInitFunctions(UClass* Class, FInitFunctionPtr& OutNativeInitFunction, UFunction*& OutBlueprintInitFunction)
+{
+    const FCacheEntry& CacheEntry = FindOrAddCacheEntry(Class);
+
+    OutNativeInitFunction = CacheEntry.NativeInitFunction;
+    OutBlueprintInitFunction = CacheEntry.BlueprintInitFunction;
+}
+
+TConstArrayView<UnrealDI_Impl::FDependenciesRegistry::FInjectedProperty> UnrealDI_Impl::FDependenciesRegistry::FindInjectedProperties(UClass* Class)
+{
+    // array storage does not move when cache map grows, so view stays valid until cache is cleared
+    return FindOrAddCacheEntry(Class).InjectedProperties;
+}
+
+bool UnrealDI_Impl::FDependenciesRegistry::IsInjectable(UClass* Class)
+{
+    const FCacheEntry& CacheEntry = FindOrAddCacheEntry(Class);
+
+    return CacheEntry.NativeInitFunction || CacheEntry.BlueprintInitFunction || CacheEntry.InjectedProperties.Num() > 0;
+}
+
+UnrealDI_Impl::FDependenciesRegistry::FCacheEntry& UnrealDI_Impl::FDependenciesRegistry::FindOrAddCacheEntry(UClass* Class)
 {
     // check cache first
     FCacheEntry* CacheEntry = CachedInitFunctions.Find(Class);
@@ -60,8 +102,22 @@ void UnrealDI_Impl::FDependenciesRegistry::FindInitFunctions(UClass* Class, FIni
         CacheEntry = AddInitFunctionsToCache(Class);
     }
 
-    OutNativeInitFunction = CacheEntry->NativeInitFunction;
-    OutBlueprintInitFunction = CacheEntry->BlueprintInitFunction;
+    return *CacheEntry;
+}
+
+const UnrealDI_Impl::FDependenciesRegistry::FInjectableSubobjects& UnrealDI_Impl::FDependenciesRegistry::FindInjectableSubobjects(UClass* Class)
+{
+    if (const TUniquePtr<FInjectableSubobjects>* CacheEntry = CachedInjectableSubobjects.Find(Class))
+    {
+        return **CacheEntry;
+    }
+
+    return AddInjectableSubobjectsToCache(Class);
+}
+
+bool UnrealDI_Impl::FDependenciesRegistry::IsInjectableWithSubobjects(UClass* Class)
+{
+    return IsInjectable(Class) || !FindInjectableSubobjects(Class).IsEmpty();
 }
 
 FName UnrealDI_Impl::FDependenciesRegistry::MakeInitDependenciesFunctionName(UClass* Class)
@@ -75,6 +131,12 @@ TArray<UnrealDI_Impl::FDependenciesRegistry::FUnprocessedEntry>& UnrealDI_Impl::
     return Result;
 }
 
+TArray<UnrealDI_Impl::FDependenciesRegistry::FUnprocessedPropertiesEntry>& UnrealDI_Impl::FDependenciesRegistry::GetUnprocessedPropertiesEntries()
+{
+    static TArray<FUnprocessedPropertiesEntry> Result;
+    return Result;
+}
+
 UnrealDI_Impl::FDependenciesRegistry::FCacheEntry* UnrealDI_Impl::FDependenciesRegistry::AddInitFunctionsToCache(UClass* Class)
 {
     UClass* ClassIterator = Class;
@@ -102,9 +164,114 @@ UnrealDI_Impl::FDependenciesRegistry::FCacheEntry* UnrealDI_Impl::FDependenciesR
         ClassIterator = ClassIterator->GetSuperClass();
     }
 
+    // offsets are taken once per class, so injection does not search properties every time.
+    // names come from generated code, because property metadata is stripped from cooked builds
+    for (UClass* OwnerClass = Class; OwnerClass; OwnerClass = OwnerClass->GetSuperClass())
+    {
+        const TArray<FName>* PropertyNames = NativeInjectedProperties.Find(OwnerClass);
+        if (!PropertyNames)
+        {
+            continue;
+        }
+
+        for (FName PropertyName : *PropertyNames)
+        {
+            FProperty* Property = FindFProperty<FProperty>(OwnerClass, PropertyName);
+            if (ensureMsgf(Property, TEXT("%s::%s is listed as injected field, but property was not found"), *OwnerClass->GetName(), *PropertyName.ToString()))
+            {
+                AddInjectedProperty(NewEntry, Class, *Property);
+            }
+        }
+    }
+
+#if WITH_METADATA
+    CheckNotExposedInjectedProperties(Class);
+#endif
+
     return &CachedInitFunctions.Add(Class, MoveTemp(NewEntry));
 }
 
+void UnrealDI_Impl::FDependenciesRegistry::AddInjectedProperty(FCacheEntry& Entry, UClass* Class, FProperty& Property)
+{
+    const bool bSupported = Property.ArrayDim == 1 && (
+        (Property.IsA<FObjectProperty>() && !Property.IsA<FClassProperty>()) || Property.IsA<FInterfaceProperty>());
+
+    if (!ensureMsgf(bSupported, TEXT("%s::%s is marked with Inject, but only single object and interface properties can be injected"), *Class->GetName(), *Property.GetName()))
+    {
+        return;
+    }
+
+    FInjectedProperty& InjectedProperty = Entry.InjectedProperties.Emplace_GetRef();
+    InjectedProperty.Offset = Property.GetOffset_ForInternal();
+
+    if (FInterfaceProperty* InterfaceProperty = CastField<FInterfaceProperty>(&Property))
+    {
+        InjectedProperty.Type = InterfaceProperty->InterfaceClass;
+        InjectedProperty.bInterface = true;
+    }
+    else
+    {
+        InjectedProperty.Type = CastFieldChecked<FObjectProperty>(&Property)->PropertyClass;
+        InjectedProperty.bInterface = false;
+    }
+}
+
+#if WITH_METADATA
+void UnrealDI_Impl::FDependenciesRegistry::CheckNotExposedInjectedProperties(UClass* Class)
+{
+    // metadata is only used to report fields that would silently stay empty in cooked builds
+    for (TFieldIterator<FProperty> It(Class, EFieldIterationFlags::IncludeSuper); It; ++It)
+    {
+        FProperty* Property = *It;
+        if (!Property->HasMetaData(TEXT("Inject")))
+        {
+            continue;
+        }
+
+        UClass* OwnerClass = Property->GetOwnerClass();
+        const TArray<FName>* PropertyNames = NativeInjectedProperties.Find(OwnerClass);
+
+        if (!OwnerClass->IsNative())
+        {
+            ensureMsgf(false, TEXT("%s::%s is marked with Inject, but Blueprint variables are not injected. Use InitDependencies node instead"), *OwnerClass->GetName(), *Property->GetName());
+        }
+        else if (!PropertyNames || !PropertyNames->Contains(Property->GetFName()))
+        {
+            ensureMsgf(false, TEXT("%s::%s is marked with Inject, but was not processed by UnrealDI code generator. Make sure module of this class is not part of Engine"), *OwnerClass->GetName(), *Property->GetName());
+        }
+    }
+}
+#endif
+
+UnrealDI_Impl::FDependenciesRegistry::FInjectableSubobjects& UnrealDI_Impl::FDependenciesRegistry::AddInjectableSubobjectsToCache(UClass* Class)
+{
+    TUniquePtr<FInjectableSubobjects> NewEntry = MakeUnique<FInjectableSubobjects>();
+
+    // default subobjects of an instance always match default subobjects of its CDO, so they can be found by name later
+    TArray<UObject*> Subobjects;
+    Class->GetDefaultObject()->GetDefaultSubobjects(Subobjects);
+
+    for (UObject* Subobject : Subobjects)
+    {
+        // subobject without dependencies may still own subobjects that have them, so classes of subobjects are checked recursively
+        if (!IsInjectableWithSubobjects(Subobject->GetClass()))
+        {
+            continue;
+        }
+
+        if (Subobject->IsA<UActorComponent>())
+        {
+            NewEntry->Components.Add(Subobject->GetFName());
+        }
+        else
+        {
+            NewEntry->Others.Add(Subobject->GetFName());
+        }
+    }
+
+    return *CachedInjectableSubobjects.Add(Class, MoveTemp(NewEntry));
+}
+
 void UnrealDI_Impl::FDependenciesRegistry::PostGarbageCollect()
 {
     for (auto It = CachedInitFunctions.CreateIterator(); It; ++It)
@@ -114,4 +281,12 @@ void UnrealDI_Impl::FDependenciesRegistry::PostGarbageCollect()
             It.RemoveCurrent();
         }
     }
+
+    for (auto It = CachedInjectableSubobjects.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
 }
@@ -0,0 +1,130 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/InitReadiness.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace UnrealDI_Impl
+{
+    // only pending tasks are stored. completed ones are removed on first lookup or after GC
+    static TMap<FObjectKey, UE::Tasks::FTask> PendingTasks;
+    static FCriticalSection PendingTasksLock;
+    static FDelegateHandle ReadinessPostGarbageCollectHandle;
+}
+
+bool FInitReadiness::IsReady(const UObject* Object)
+{
+    return WhenReady(Object).IsCompleted();
+}
+
+UE::Tasks::FTask FInitReadiness::WhenReady(const UObject* Object)
+{
+    using namespace UnrealDI_Impl;
+
+    FScopeLock Lock(&PendingTasksLock);
+
+    const FObjectKey Key(Object);
+    if (UE::Tasks::FTask* Task = PendingTasks.Find(Key))
+    {
+        if (!Task->IsCompleted())
+        {
+            return *Task;
+        }
+
+        PendingTasks.Remove(Key);
+    }
+
+    // default constructed task is treated as completed
+    return UE::Tasks::FTask();
+}
+
+UE::Tasks::FTask FInitReadiness::WhenAllReady(TArrayView<const UObject* const> Objects)
+{
+    TArray<UE::Tasks::FTask> Tasks;
+    for (const UObject* Object : Objects)
+    {
+        AppendPending(Tasks, Object);
+    }
+
+    if (Tasks.Num() == 0)
+    {
+        return UE::Tasks::FTask();
+    }
+
+    if (Tasks.Num() == 1)
+    {
+        return Tasks[0];
+    }
+
+    return UE::Tasks::Launch(UE_SOURCE_LOCATION, [] {}, UE::Tasks::Prerequisites(Tasks), UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::Inline);
+}
+
+void FInitReadiness::AppendPending(TArray<UE::Tasks::FTask>& OutTasks, const UObject* Object)
+{
+    if (Object == nullptr)
+    {
+        return;
+    }
+
+    UE::Tasks::FTask Task = WhenReady(Object);
+    if (!Task.IsCompleted())
+    {
+        OutTasks.Add(MoveTemp(Task));
+    }
+}
+
+void FInitReadiness::Track(const UObject& Object, const UE::Tasks::FTask& InitTask, TArrayView<const UE::Tasks::FTask> DependencyTasks)
+{
+    using namespace UnrealDI_Impl;
+
+    UE::Tasks::FTask ReadyTask;
+
+    if (DependencyTasks.Num() == 0)
+    {
+        ReadyTask = InitTask;
+    }
+    else
+    {
+        TArray<UE::Tasks::FTask> AllTasks(DependencyTasks);
+        if (InitTask.IsValid())
+        {
+            AllTasks.Add(InitTask);
+        }
+
+        ReadyTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [] {}, UE::Tasks::Prerequisites(AllTasks), UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::Inline);
+    }
+
+    if (ReadyTask.IsCompleted())
+    {
+        return;
+    }
+
+    FScopeLock Lock(&PendingTasksLock);
+    PendingTasks.Add(FObjectKey(&Object), MoveTemp(ReadyTask));
+}
+
+void FInitReadiness::Init()
+{
+    UnrealDI_Impl::ReadinessPostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FInitReadiness::PostGarbageCollect);
+}
+
+void FInitReadiness::Shutdown()
+{
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(UnrealDI_Impl::ReadinessPostGarbageCollectHandle);
+}
+
+void FInitReadiness::PostGarbageCollect()
+{
+    using namespace UnrealDI_Impl;
+
+    FScopeLock Lock(&PendingTasksLock);
+
+    for (auto It = PendingTasks.CreateIterator(); It; ++It)
+    {
+        if (It.Key().ResolveObjectPtr() == nullptr || It.Value().IsCompleted())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
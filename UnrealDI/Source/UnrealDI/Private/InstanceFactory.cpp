@@ -0,0 +1,16 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/IInstanceFactory.h"
+#include "GameFramework/Actor.h"
+
+UObject* IInstanceFactory::CreateAt(UObject* Outer, UClass* EffectiveClass, const FTransform& Transform) const
+{
+    UObject* Result = Create(Outer, EffectiveClass);
+
+    if (AActor* Actor = Cast<AActor>(Result))
+    {
+        Actor->SetActorTransform(Transform);
+    }
+
+    return Result;
+}
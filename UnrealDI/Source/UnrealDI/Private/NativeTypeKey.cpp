@@ -0,0 +1,35 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/Impl/NativeTypeKey.h"
+#include "Containers/Map.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/UniquePtr.h"
+
+namespace UnrealDI_Impl
+{
+    // default FString key funcs ignore case, but C++ type names differ by case
+    struct FCaseSensitiveStringKeyFuncs : TDefaultMapKeyFuncs<FString, TUniquePtr<FNativeTypeKey>, false>
+    {
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+    };
+
+    static TMap<FString, TUniquePtr<FNativeTypeKey>, FDefaultSetAllocator, FCaseSensitiveStringKeyFuncs> NativeTypeKeys;
+    static FCriticalSection NativeTypeKeysLock;
+}
+
+const UnrealDI_Impl::FNativeTypeKey* UnrealDI_Impl::FNativeTypeKey::FindOrAdd(const ANSICHAR* Signature)
+{
+    FString Name(Signature);
+
+    FScopeLock Lock(&NativeTypeKeysLock);
+
+    TUniquePtr<FNativeTypeKey>& Key = NativeTypeKeys.FindOrAdd(Name);
+    if (!Key.IsValid())
+    {
+        Key = MakeUnique<FNativeTypeKey>();
+        Key->Name = MoveTemp(Name);
+    }
+
+    return Key.Get();
+}
@@ -2,9 +2,73 @@
 
 #include "DI/ObjectContainer.h"
 #include "DI/ObjectsCollection.h"
+#include "DI/IDisposable.h"
+#include "DI/InitReadiness.h"
+#include "DI/InjectOnConstruction.h"
 #include "DI/Impl/DefaultInstanceFactory.h"
 #include "DI/Impl/DependenciesRegistry.h"
 #include "DI/Impl/Lifetimes.h"
+#include "DI/Impl/NativeLifetimes.h"
+#include "DI/Impl/TypedInstanceCreator.h"
+#include "SlowResolveDetector.h"
+#include "TransientChurnTracker.h"
+#include "UnrealDILog.h"
+#include "Components/ActorComponent.h"
+#include "Engine/AssetManager.h"
+#include "GameFramework/Actor.h"
+#include "Blueprint/UserWidget.h"
+#include "Misc/CoreDelegates.h"
+
+namespace UnrealDI_Impl
+{
+    // lifetime whose instance is being created. frames live on the stack of ResolveImpl, innermost one is linked from root container of the resolve chain
+    struct FCreationFrame
+    {
+        TSharedRef<FLifetimeHandler> Lifetime;
+        FCreationFrame* Outer;
+    };
+
+    // makes Lifetime receive dependencies of everything resolved until the scope ends, if it keeps its instance
+    class FCreationScope
+    {
+    public:
+        FCreationScope(FCreationFrame*& InChain, const TSharedRef<FLifetimeHandler>& Lifetime)
+            : Chain(InChain)
+            , Frame{ Lifetime, InChain }
+            , bLinked(Lifetime->KeepsInstance())
+        {
+            if (bLinked)
+            {
+                Chain = &Frame;
+            }
+        }
+
+        ~FCreationScope()
+        {
+            if (bLinked)
+            {
+                Chain = Frame.Outer;
+            }
+        }
+
+    private:
+        FCreationFrame*& Chain;
+        FCreationFrame Frame;
+        bool bLinked;
+    };
+
+    // returns lifetime of entry, or null if it was destroyed or created its instance again after entry was added
+    static TSharedPtr<FLifetimeHandler> PinCurrent(const FCreatedSharedLifetime& Created)
+    {
+        TSharedPtr<FLifetimeHandler> Lifetime = Created.Lifetime.Pin();
+        if (Lifetime.IsValid() && Lifetime->CreationSequence == Created.Sequence)
+        {
+            return Lifetime;
+        }
+
+        return nullptr;
+    }
+}
 
 UObject* UObjectContainer::Resolve(UClass* Type) const
 {
@@ -14,6 +78,57 @@ UObject* UObjectContainer::Resolve(UClass* Type) const
     return ResolveImpl(*Resolver, Container);
 }
 
+void UObjectContainer::ResolveMany(TArrayView<UClass* const> Types, TArrayView<UObject*> OutObjects) const
+{
+    const TArray<UClass*> FailedTypes = TryResolveMany(Types, OutObjects);
+
+    checkf(FailedTypes.Num() == 0, TEXT("Types are not registered and may not be auto registered: %s"),
+        *FString::JoinBy(FailedTypes, TEXT(", "), [](UClass* Type) { return Type ? Type->GetName() : FString(TEXT("null")); }));
+}
+
+TArray<UClass*> UObjectContainer::TryResolveMany(TArrayView<UClass* const> Types, TArrayView<UObject*> OutObjects) const
+{
+    checkf(Types.Num() == OutObjects.Num(), TEXT("Types and OutObjects must have the same size"));
+
+    struct FFoundResolver
+    {
+        int32 Index;
+        FResolver Resolver;
+        const UObjectContainer* Container;
+    };
+
+    TArray<UClass*> FailedTypes;
+
+    // look up all registrations first. resolvers are copied, because creating instances may add auto registrations
+    TArray<FFoundResolver, TInlineAllocator<16>> FoundResolvers;
+    for (int32 i = 0; i < Types.Num(); ++i)
+    {
+        OutObjects[i] = nullptr;
+
+        if (Types[i] == nullptr)
+        {
+            FailedTypes.Add(nullptr);
+            continue;
+        }
+
+        const auto [Resolver, Container] = GetResolver<false>(Types[i]);
+        if (Resolver == nullptr)
+        {
+            FailedTypes.Add(Types[i]);
+            continue;
+        }
+
+        FoundResolvers.Add({ i, *Resolver, Container });
+    }
+
+    for (const FFoundResolver& Found : FoundResolvers)
+    {
+        OutObjects[Found.Index] = ResolveImpl(Found.Resolver, Found.Container);
+    }
+
+    return FailedTypes;
+}
+
 TObjectsCollection<UObject> UObjectContainer::ResolveAll(UClass* Type) const
 {
     checkf(Type, TEXT("Requested object of null type"));
@@ -52,6 +167,59 @@ TFactory<UObject> UObjectContainer::TryResolveFactory(UClass* Type) const
     return Resolver != nullptr ? TFactory<UObject>(*Container, &ThisClass::ResolveFromContext) : TFactory<UObject>();
 }
 
+UObject* UObjectContainer::ResolveKeyed(UClass* Type, FName Key) const
+{
+    checkf(Type, TEXT("Requested object of null type"));
+
+    const auto [Resolver, Container] = FindKeyedResolver(MakeTuple(Type, Key));
+    checkf(Resolver != nullptr, TEXT("Type %s is not registered with key %s"), *Type->GetName(), *Key.ToString());
+
+    return ResolveImpl(*Resolver, Container);
+}
+
+UObject* UObjectContainer::TryResolveKeyed(UClass* Type, FName Key) const
+{
+    checkf(Type, TEXT("Requested object of null type"));
+
+    const auto [Resolver, Container] = FindKeyedResolver(MakeTuple(Type, Key));
+    return Resolver != nullptr ? ResolveImpl(*Resolver, Container) : nullptr;
+}
+
+TObjectsMap<FName, UObject> UObjectContainer::ResolveMap(UClass* Type) const
+{
+    checkf(Type, TEXT("Requested object of null type"));
+
+    if (const TSharedRef<const UnrealDI_Impl::FObjectsMapIndex>* Index = ObjectsMapIndices.Find(Type))
+    {
+        return TObjectsMap<FName, UObject>(*this, &ThisClass::ResolveKeyedFromContext, *Index);
+    }
+
+    TSharedRef<UnrealDI_Impl::FObjectsMapIndex> Index = MakeShared<UnrealDI_Impl::FObjectsMapIndex>();
+    Index->Type = Type;
+
+    // parent keys go first, so order of keys matches order of registrations
+    TArray<const UObjectContainer*, TInlineAllocator<4>> Containers;
+    for (const UObjectContainer* Container = this; Container != nullptr; Container = Container->ParentContainer)
+    {
+        Containers.Insert(Container, 0);
+    }
+
+    for (const UObjectContainer* Container : Containers)
+    {
+        for (const auto& KeyedResolver : Container->KeyedRegistrations)
+        {
+            if (KeyedResolver.Key.Get<0>() == Type && !Index->KeyToIndex.Contains(KeyedResolver.Key.Get<1>()))
+            {
+                Index->KeyToIndex.Add(KeyedResolver.Key.Get<1>(), Index->Keys.Add(KeyedResolver.Key.Get<1>()));
+            }
+        }
+    }
+
+    ObjectsMapIndices.Add(Type, Index);
+
+    return TObjectsMap<FName, UObject>(*this, &ThisClass::ResolveKeyedFromContext, Index);
+}
+
 bool UObjectContainer::IsRegistered(UClass* Type) const
 {
     checkf(Type, TEXT("Requested object of null type"));
@@ -68,22 +236,81 @@ bool UObjectContainer::IsRegistered(UClass* Type) const
     return false;
 }
 
+bool UObjectContainer::TryResolveNative(const UnrealDI_Impl::FNativeTypeKey* TypeKey, void* OutInstance) const
+{
+    check(OutInstance);
+
+    if (const TSharedRef<UnrealDI_Impl::FNativeLifetimeHandler>* LifetimeHandler = NativeRegistrations.Find(TypeKey))
+    {
+        // keep handler alive for the duration of the call, it may create other services that modify the container
+        TSharedRef<UnrealDI_Impl::FNativeLifetimeHandler> Handler = *LifetimeHandler;
+        Handler->Resolve(*this, OutInstance);
+        return true;
+    }
+    else if (ParentContainer)
+    {
+        return ParentContainer->TryResolveNative(TypeKey, OutInstance);
+    }
+
+    return false;
+}
+
 bool UObjectContainer::Inject(UObject* Object) const
 {
-    using namespace UnrealDI_Impl;
+    return Inject(Object, InjectSubobjectsMode);
+}
+
+bool UObjectContainer::Inject(UObject* Object, EInjectSubobjects Mode) const
+{
     check(Object);
 
-    UClass* Class = Object->GetClass();
+    bool bInjected = InjectObject(*Object);
+
+    if (Mode != EInjectSubobjects::None)
+    {
+        bInjected |= InjectSubobjects(*Object, Mode);
+
+        if (AActor* Actor = Cast<AActor>(Object))
+        {
+            bInjected |= InjectInstanceComponents(*Actor, Mode);
+        }
+    }
+
+    return bInjected;
+}
+
+bool UObjectContainer::InjectObject(UObject& Object) const
+{
+    using namespace UnrealDI_Impl;
+
+    UClass* Class = Object.GetClass();
 
     FDependenciesRegistry::FInitFunctionPtr NativeInitFunction = nullptr;
     UFunction* BlueprintInitFunction = nullptr;
 
     FDependenciesRegistry::FindInitFunctions(Class, NativeInitFunction, BlueprintInitFunction);
 
-    // first - call native InitDependencies
+    // first - write fields marked with meta=(Inject), so InitDependencies may already use them
+    const TConstArrayView<FDependenciesRegistry::FInjectedProperty> InjectedProperties = FDependenciesRegistry::FindInjectedProperties(Class);
+    for (const FDependenciesRegistry::FInjectedProperty& InjectedProperty : InjectedProperties)
+    {
+        uint8* Address = reinterpret_cast<uint8*>(&Object) + InjectedProperty.Offset;
+        UObject* Result = Resolve(InjectedProperty.Type);
+
+        if (InjectedProperty.bInterface)
+        {
+            *reinterpret_cast<FScriptInterface*>(Address) = FScriptInterface(Result, Result->GetInterfaceAddress(InjectedProperty.Type));
+        }
+        else
+        {
+            *reinterpret_cast<TObjectPtr<UObject>*>(Address) = Result;
+        }
+    }
+
+    // then - call native InitDependencies
     if (NativeInitFunction != nullptr)
     {
-        NativeInitFunction(*Object, *static_cast<const IResolver*>(this));
+        NativeInitFunction(Object, *static_cast<const IResolver*>(this));
     }
 
     // then -  call blueprint InitDependencies
@@ -115,10 +342,62 @@ bool UObjectContainer::Inject(UObject* Object) const
 
         check(CurrentArgument - Arguments == BlueprintInitFunction->ParmsSize);
 
-        Object->ProcessEvent(BlueprintInitFunction, Arguments);
+        Object.ProcessEvent(BlueprintInitFunction, Arguments);
+    }
+
+    return NativeInitFunction || BlueprintInitFunction || InjectedProperties.Num() > 0;
+}
+
+bool UObjectContainer::InjectSubobjects(UObject& Object, EInjectSubobjects Mode) const
+{
+    using namespace UnrealDI_Impl;
+
+    bool bInjected = false;
+
+    const FDependenciesRegistry::FInjectableSubobjects& Subobjects = FDependenciesRegistry::FindInjectableSubobjects(Object.GetClass());
+
+    if (AActor* Actor = Cast<AActor>(&Object))
+    {
+        // components created in constructor are found through cached slots
+        for (FName Name : Subobjects.Components)
+        {
+            if (UObject* Component = Actor->GetDefaultSubobjectByName(Name))
+            {
+                bInjected |= Inject(Component, Mode);
+            }
+        }
+    }
+
+    if (Mode == EInjectSubobjects::ComponentsAndDefaultSubobjects)
+    {
+        for (FName Name : Subobjects.Others)
+        {
+            if (UObject* Subobject = Object.GetDefaultSubobjectByName(Name))
+            {
+                bInjected |= Inject(Subobject, Mode);
+            }
+        }
     }
 
-    return NativeInitFunction || BlueprintInitFunction;
+    return bInjected;
+}
+
+bool UObjectContainer::InjectInstanceComponents(AActor& Actor, EInjectSubobjects Mode) const
+{
+    using namespace UnrealDI_Impl;
+
+    bool bInjected = false;
+
+    // components added by construction script or at runtime differ per instance, default ones are injected by InjectSubobjects
+    Actor.ForEachComponent(false, [&](UActorComponent* Component)
+    {
+        if (!Component->HasAnyFlags(RF_DefaultSubObject) && FDependenciesRegistry::IsInjectableWithSubobjects(Component->GetClass()))
+        {
+            bInjected |= Inject(Component, Mode);
+        }
+    });
+
+    return bInjected;
 }
 
 bool UObjectContainer::CanInject(UClass* Class) const
@@ -126,23 +405,69 @@ bool UObjectContainer::CanInject(UClass* Class) const
     using namespace UnrealDI_Impl;
     check(Class);
 
-    FDependenciesRegistry::FInitFunctionPtr NativeInitFunction = nullptr;
-    UFunction* BlueprintInitFunction = nullptr;
+    return FDependenciesRegistry::IsInjectable(Class);
+}
 
-    FDependenciesRegistry::FindInitFunctions(Class, NativeInitFunction, BlueprintInitFunction);
+void UObjectContainer::AddRegistration(UClass* Interface, TSoftClassPtr<UObject> EffectiveClass, const TSharedRef<UnrealDI_Impl::FLifetimeHandler>& Lifetime, const UnrealDI_Impl::FTypedInstanceCreator* TypedCreator)
+{
+    Lifetime->OnAddedToContainer(*this);
+
+    FResolversArray& Resolvers = Registrations.FindOrAdd(Interface);
 
-    return NativeInitFunction || BlueprintInitFunction;
+    Resolvers.Emplace(FResolver{ Interface, MoveTemp(EffectiveClass), Lifetime, TypedCreator });
 }
 
-void UObjectContainer::AddRegistration(UClass* Interface, TSoftClassPtr<UObject> EffectiveClass, const TSharedRef<UnrealDI_Impl::FLifetimeHandler>& Lifetime)
+template <typename TCallback>
+void UObjectContainer::ForEachResolver(TCallback&& Callback)
 {
-    FResolversArray& Resolvers = Registrations.FindOrAdd(Interface);
+    for (auto& Resolvers : Registrations)
+    {
+        for (FResolver& Resolver : Resolvers.Value)
+        {
+            Callback(Resolver);
+        }
+    }
+
+    for (auto& KeyedResolver : KeyedRegistrations)
+    {
+        Callback(KeyedResolver.Value);
+    }
+}
+
+void UObjectContainer::AttachRegistrationTables(UnrealDI_Impl::FRegistrationTables&& Tables)
+{
+    Registrations = MoveTemp(Tables.Registrations);
+    KeyedRegistrations = MoveTemp(Tables.KeyedRegistrations);
+    NativeRegistrations = MoveTemp(Tables.NativeRegistrations);
 
-    Resolvers.Emplace(FResolver{ MoveTemp(EffectiveClass), Lifetime });
+    ForEachResolver([this](FResolver& Resolver)
+    {
+        Resolver.LifetimeHandler->OnAddedToContainer(*this);
+    });
 }
 
 void UObjectContainer::InitServices()
 {
+    using namespace UnrealDI_Impl;
+
+    // typed creators skip registry lookup on each resolve, so find native injector once
+    ForEachResolver([](FResolver& Resolver)
+    {
+        if (Resolver.TypedCreator != nullptr)
+        {
+            UFunction* BlueprintInitFunction = nullptr;
+            FDependenciesRegistry::FindInitFunctions(Resolver.EffectiveClass.Get(), Resolver.InjectFunction, BlueprintInitFunction);
+            check(BlueprintInitFunction == nullptr);
+
+            // injected fields are written by InjectObject only
+            if (FDependenciesRegistry::FindInjectedProperties(Resolver.EffectiveClass.Get()).Num() > 0)
+            {
+                Resolver.TypedCreator = nullptr;
+                Resolver.InjectFunction = nullptr;
+            }
+        }
+    });
+
     if (ParentContainer == nullptr)
     {
         // no point in creating Default Factory if we have parent container. we can take it from there
@@ -157,6 +482,22 @@ void UObjectContainer::InitServices()
 
     // order by 'most recently added'
     Algo::Reverse(InstanceFactories);
+
+    DisableTypedCreatorsForCustomFactories();
+}
+
+void UObjectContainer::DisableTypedCreatorsForCustomFactories()
+{
+    // typed creators do the same as default factory, so they can't be used for classes that are handled by custom factories
+    const IInstanceFactory* DefaultFactory = GetMutableDefault<UDefaultInstanceFactory>();
+    ForEachResolver([this, DefaultFactory](FResolver& Resolver)
+    {
+        if (Resolver.TypedCreator != nullptr && FindInstanceFactory(Resolver.EffectiveClass.Get()) != DefaultFactory)
+        {
+            Resolver.TypedCreator = nullptr;
+            Resolver.InjectFunction = nullptr;
+        }
+    });
 }
 
 template <bool bCheck>
@@ -180,8 +521,10 @@ TTuple<const UObjectContainer::FResolver*, const UObjectContainer*> UObjectConta
         return MakeTuple(nullptr, this);
     }
 
+    checkf(!bShutDown, TEXT("Requested object of type %s from container that was shut down"), *Type->GetName());
+
     // auto-register Type if no registration found for it
-    FResolversArray& NewArray = const_cast<UObjectContainer*>(this)->Registrations.Emplace(Type, { FResolver { Type, MakeShared<UnrealDI_Impl::FLifetimeHandler_Transient>() } });
+    FResolversArray& NewArray = const_cast<UObjectContainer*>(this)->Registrations.Emplace(Type, { FResolver { Type, Type, MakeShared<UnrealDI_Impl::FLifetimeHandler_Transient>() } });
 
     return MakeTuple(&NewArray.Last(), this);
 }
@@ -202,96 +545,302 @@ TTuple<const UObjectContainer::FResolver*, const UObjectContainer*> UObjectConta
     return MakeTuple(nullptr, this);
 }
 
-IInstanceFactory* UObjectContainer::FindInstanceFactory(UClass* Type) const
+TTuple<const UObjectContainer::FResolver*, const UObjectContainer*> UObjectContainer::FindKeyedResolver(const TTuple<UClass*, FName>& TypeAndKey) const
 {
-    for (auto& InstanceFactory : InstanceFactories)
+    // hash is computed once and reused for lookups in parent containers
+    const uint32 Hash = GetTypeHash(TypeAndKey);
+
+    for (const UObjectContainer* Container = this; Container != nullptr; Container = Container->ParentContainer)
     {
-        if (InstanceFactory->IsClassSupported(Type))
+        if (const FResolver* Resolver = Container->KeyedRegistrations.FindByHash(Hash, TypeAndKey))
         {
-            return InstanceFactory.GetInterface();
+            return MakeTuple(Resolver, Container);
         }
     }
 
-    // ParentContainer cannot not be null here
-    return ParentContainer->FindInstanceFactory(Type);
+    return MakeTuple(nullptr, this);
 }
 
-UObject* UObjectContainer::ResolveImpl(const FResolver& Resolver, const UObjectContainer* OwningContainer)
+TTuple<const UObjectContainer::FResolver*, const UObjectContainer*> UObjectContainer::FindResolverByLifetime(const UnrealDI_Impl::FLifetimeHandler& LifetimeHandler) const
 {
-    // cache reference to LifetimeHandler, because reference to Resolver may become invalid during call to Inject due to Registrations map memory reallocation
-    UnrealDI_Impl::FLifetimeHandler& LifetimeHandler = Resolver.LifetimeHandler.Get();
-
-    UObject* Result = LifetimeHandler.Get();
-    if (Result == nullptr)
+    for (const UObjectContainer* Container = this; Container != nullptr; Container = Container->ParentContainer)
     {
-        UClass* EffectiveClass = Resolver.EffectiveClass.LoadSynchronous();
-        check(EffectiveClass != nullptr);
-
-        // create and initialize instance
-        IInstanceFactory* Factory = OwningContainer->FindInstanceFactory(EffectiveClass);
-        check(Factory != nullptr);
-
-        Result = Factory->Create(OwningContainer->OuterForNewObjects, EffectiveClass);
-        checkf(Result != nullptr, TEXT("IInstanceFactory must never return nullptr. Check project specific implementation"));
-
-        OwningContainer->Inject(Result);
-        // Resolver may be invalid after this call
-
-        Factory->FinalizeCreation(Result);
+        for (auto& Resolvers : Container->Registrations)
+        {
+            for (const FResolver& Resolver : Resolvers.Value)
+            {
+                if (&Resolver.LifetimeHandler.Get() == &LifetimeHandler)
+                {
+                    return MakeTuple(&Resolver, Container);
+                }
+            }
+        }
 
-        LifetimeHandler.Set(Result);
+        for (auto& KeyedResolver : Container->KeyedRegistrations)
+        {
+            if (&KeyedResolver.Value.LifetimeHandler.Get() == &LifetimeHandler)
+            {
+                return MakeTuple(&KeyedResolver.Value, Container);
+            }
+        }
     }
 
-    return Result;
+    return MakeTuple(nullptr, this);
 }
 
-template <bool bCheck>
-TObjectsCollection<UObject> UObjectContainer::ResolveAllImpl(UClass* Type) const
+TSharedPtr<UnrealDI_Impl::FLifetimeHandler> UObjectContainer::FindSharedLifetime(UClass* Type) const
 {
-    const UObjectContainer* Container = this;
-    int32 TotalResolvers = 0;
+    const auto [Resolver, Container] = GetResolver<true>(Type);
 
-    // calculate total count, so we can allocate enough memory
-    while (Container)
+    if (Resolver != nullptr && Resolver->LifetimeHandler->IsShared())
     {
-        const FResolversArray* Resolvers = Container->Registrations.Find(Type);
-        TotalResolvers += Resolvers ? Resolvers->Num() : 0;
-        Container = Container->ParentContainer;
+        return Resolver->LifetimeHandler;
     }
 
-    if constexpr (bCheck)
-    {
-        // if no types were registered, it's probably not what was expected
-        checkf(TotalResolvers > 0, TEXT("Type %s is not registered"), *Type->GetName());
-    }
-    else
+    return nullptr;
+}
+
+IInstanceFactory* UObjectContainer::FindInstanceFactory(UClass* Type) const
+{
+    for (auto& InstanceFactory : InstanceFactories)
     {
-        if (TotalResolvers == 0)
+        if (InstanceFactory->IsClassSupported(Type))
         {
-            return TObjectsCollection<UObject>();
+            return InstanceFactory.GetInterface();
         }
     }
 
-    // Data will be owned by TObjectsCollection and freed by it
-    UObject** Data = (UObject**)FMemory::Malloc(TotalResolvers * sizeof(UObject*));
-
-    UObject** Iter = Data; // we need a copy of Data, because AppendObjectsCollection will modify it
-    AppendObjectsCollection(Type, Iter);
-
-    return TObjectsCollection<UObject>(Data, TotalResolvers);
+    // ParentContainer cannot not be null here
+    return ParentContainer->FindInstanceFactory(Type);
 }
 
-void UObjectContainer::AppendObjectsCollection(UClass* Type, UObject**& Data) const
+UObject* UObjectContainer::ResolveImpl(const FResolver& Resolver, const UObjectContainer* OwningContainer)
 {
-    if (ParentContainer)
+    // cache LifetimeHandler, because reference to Resolver may become invalid during call to Inject due to Registrations map memory reallocation
+    const TSharedRef<UnrealDI_Impl::FLifetimeHandler> LifetimeHandlerRef = Resolver.LifetimeHandler;
+    UnrealDI_Impl::FLifetimeHandler& LifetimeHandler = LifetimeHandlerRef.Get();
+
+    // resolves of parent registrations continue the same chain, so it is kept by the root container
+    UnrealDI_Impl::FCreationFrame*& CreationChain = OwningContainer->GetRootContainer().CreationChain;
+    if (CreationChain != nullptr)
     {
-        ParentContainer->AppendObjectsCollection(Type, Data);
+        LifetimeHandler.AddDependent(CreationChain->Lifetime);
+
+        if (!LifetimeHandler.IsShared())
+        {
+            CreationChain->Lifetime->bReceivedUnsharedDependencies = true;
+        }
     }
 
-    const FResolversArray* Resolvers = Registrations.Find(Type);
-    if (Resolvers)
+    if (OwningContainer->bRecordingWarmUp)
     {
-        for (const FResolver& Resolver : *Resolvers)
+        OwningContainer->RecordWarmUpEntry(Resolver);
+    }
+
+    UnrealDI_Impl::FSlowResolveDetector::FScope SlowResolveScope(LifetimeHandler, Resolver.Interface);
+
+    UObject* Result = LifetimeHandler.Get();
+    if (Result == nullptr)
+    {
+        UnrealDI_Impl::FCreationScope CreationScope(CreationChain, LifetimeHandlerRef);
+
+        UObject* Archetype = LifetimeHandler.GetArchetype();
+        if (Archetype == nullptr)
+        {
+            // dependencies are recorded again for instance created from scratch
+            LifetimeHandler.bReceivedUnsharedDependencies = false;
+        }
+
+        if (Archetype != nullptr)
+        {
+            // copy already holds injected state of archetype. dependencies that are not shared must be resolved again for each copy
+            const bool bInject = LifetimeHandler.bReceivedUnsharedDependencies;
+
+            UClass* EffectiveClass = Archetype->GetClass();
+            SlowResolveScope.MarkLoaded(EffectiveClass);
+
+            IInstanceFactory* Factory = OwningContainer->FindInstanceFactory(EffectiveClass);
+            check(Factory != nullptr);
+
+            Result = NewObject<UObject>(OwningContainer->OuterForNewObjects, EffectiveClass, NAME_None, RF_NoFlags, Archetype);
+            SlowResolveScope.MarkCreated(nullptr);
+
+            if (bInject)
+            {
+                OwningContainer->InjectObject(*Result);
+                // Resolver may be invalid after this call
+
+                if (OwningContainer->InjectSubobjectsMode != EInjectSubobjects::None)
+                {
+                    OwningContainer->InjectSubobjects(*Result, OwningContainer->InjectSubobjectsMode);
+                }
+            }
+            SlowResolveScope.MarkInjected();
+
+            Factory->FinalizeCreation(Result);
+            SlowResolveScope.MarkFinalized();
+        }
+        else if (Resolver.TypedCreator != nullptr)
+        {
+            // native type that default factory would create. copy what we need, Resolver may be invalid after injection
+            const UnrealDI_Impl::FTypedInstanceCreator& TypedCreator = *Resolver.TypedCreator;
+            const auto InjectFunction = Resolver.InjectFunction;
+
+            Result = TypedCreator.Create(OwningContainer->OuterForNewObjects);
+            check(Result != nullptr);
+            SlowResolveScope.MarkLoaded(Result->GetClass());
+            SlowResolveScope.MarkCreated(nullptr);
+
+            if (InjectFunction != nullptr)
+            {
+                InjectFunction(*Result, *static_cast<const IResolver*>(OwningContainer));
+            }
+
+            if (OwningContainer->InjectSubobjectsMode != EInjectSubobjects::None)
+            {
+                OwningContainer->InjectSubobjects(*Result, OwningContainer->InjectSubobjectsMode);
+            }
+            SlowResolveScope.MarkInjected();
+
+            if (TypedCreator.Finalize != nullptr)
+            {
+                TypedCreator.Finalize(*Result);
+            }
+            SlowResolveScope.MarkFinalized();
+        }
+        else
+        {
+            UClass* EffectiveClass = Resolver.EffectiveClass.LoadSynchronous();
+            check(EffectiveClass != nullptr);
+            SlowResolveScope.MarkLoaded(EffectiveClass);
+
+            // create and initialize instance
+            IInstanceFactory* Factory = OwningContainer->FindInstanceFactory(EffectiveClass);
+            check(Factory != nullptr);
+
+            Result = Factory->Create(OwningContainer->OuterForNewObjects, EffectiveClass);
+            checkf(Result != nullptr, TEXT("IInstanceFactory must never return nullptr. Check project specific implementation"));
+            SlowResolveScope.MarkCreated(Factory);
+
+            OwningContainer->InjectObject(*Result);
+            // Resolver may be invalid after this call
+
+            if (OwningContainer->InjectSubobjectsMode != EInjectSubobjects::None)
+            {
+                OwningContainer->InjectSubobjects(*Result, OwningContainer->InjectSubobjectsMode);
+            }
+            SlowResolveScope.MarkInjected();
+
+            Factory->FinalizeCreation(Result);
+            SlowResolveScope.MarkFinalized();
+        }
+
+        // construction script adds its components while spawning is finished, so they can be injected only now
+        if (OwningContainer->InjectSubobjectsMode != EInjectSubobjects::None)
+        {
+            if (AActor* Actor = Cast<AActor>(Result))
+            {
+                OwningContainer->InjectInstanceComponents(*Actor, OwningContainer->InjectSubobjectsMode);
+            }
+        }
+
+        LifetimeHandler.Set(Result);
+
+        if (LifetimeHandler.IsShared())
+        {
+            OwningContainer->AddCreatedSharedLifetime(LifetimeHandlerRef);
+        }
+
+        if (UnrealDI_Impl::FTransientChurnTracker::IsEnabled() && !LifetimeHandler.IsShared())
+        {
+            UnrealDI_Impl::FTransientChurnTracker::OnCreated(*Result);
+        }
+    }
+
+    return Result;
+}
+
+void UObjectContainer::AddCreatedSharedLifetime(const TSharedRef<UnrealDI_Impl::FLifetimeHandler>& Lifetime) const
+{
+    // recreated instances (e.g. after TrimMemory) move to the end, as they are newer than everything else now. their old entry becomes stale
+    Lifetime->CreationSequence = ++LastCreationSequence;
+    CreatedSharedLifetimes.Add({ Lifetime, LastCreationSequence });
+
+    // stale entries are dropped when array doubles since last compaction, so each creation costs constant time on average
+    if (CreatedSharedLifetimes.Num() >= FMath::Max(2 * NumCompactedSharedLifetimes, 32))
+    {
+        CompactCreatedSharedLifetimes();
+    }
+}
+
+void UObjectContainer::CompactCreatedSharedLifetimes() const
+{
+    CreatedSharedLifetimes.RemoveAll([](const UnrealDI_Impl::FCreatedSharedLifetime& Created)
+    {
+        return !UnrealDI_Impl::PinCurrent(Created).IsValid();
+    });
+
+    NumCompactedSharedLifetimes = CreatedSharedLifetimes.Num();
+}
+
+const UObjectContainer& UObjectContainer::GetRootContainer() const
+{
+    const UObjectContainer* Container = this;
+    while (Container->ParentContainer)
+    {
+        Container = Container->ParentContainer;
+    }
+
+    return *Container;
+}
+
+template <bool bCheck>
+TObjectsCollection<UObject> UObjectContainer::ResolveAllImpl(UClass* Type) const
+{
+    const UObjectContainer* Container = this;
+    int32 TotalResolvers = 0;
+
+    // calculate total count, so we can allocate enough memory
+    while (Container)
+    {
+        const FResolversArray* Resolvers = Container->Registrations.Find(Type);
+        TotalResolvers += Resolvers ? Resolvers->Num() : 0;
+        Container = Container->ParentContainer;
+    }
+
+    if constexpr (bCheck)
+    {
+        // if no types were registered, it's probably not what was expected
+        checkf(TotalResolvers > 0, TEXT("Type %s is not registered"), *Type->GetName());
+    }
+    else
+    {
+        if (TotalResolvers == 0)
+        {
+            return TObjectsCollection<UObject>();
+        }
+    }
+
+    // Data will be owned by TObjectsCollection and freed by it
+    UObject** Data = (UObject**)FMemory::Malloc(TotalResolvers * sizeof(UObject*));
+
+    UObject** Iter = Data; // we need a copy of Data, because AppendObjectsCollection will modify it
+    AppendObjectsCollection(Type, Iter);
+
+    return TObjectsCollection<UObject>(Data, TotalResolvers);
+}
+
+void UObjectContainer::AppendObjectsCollection(UClass* Type, UObject**& Data) const
+{
+    if (ParentContainer)
+    {
+        ParentContainer->AppendObjectsCollection(Type, Data);
+    }
+
+    const FResolversArray* Resolvers = Registrations.Find(Type);
+    if (Resolvers)
+    {
+        for (const FResolver& Resolver : *Resolvers)
         {
             *Data = ResolveImpl(Resolver, this);
             ++Data;
@@ -299,6 +848,635 @@ void UObjectContainer::AppendObjectsCollection(UClass* Type, UObject**& Data) co
     }
 }
 
+TObjectsCollection<UObject> UObjectContainer::ResolveActors(UClass* Type, TArrayView<const FTransform> Transforms) const
+{
+    checkf(Type, TEXT("Requested object of null type"));
+
+    if (Transforms.Num() == 0)
+    {
+        return TObjectsCollection<UObject>();
+    }
+
+    // everything that doesn't depend on particular actor is done once for the whole batch
+    const auto [Resolver, Container] = GetResolver<true>(Type);
+
+    // keep handler alive, Resolver may become invalid during injection
+    const TSharedRef<UnrealDI_Impl::FLifetimeHandler> LifetimeHandler = Resolver->LifetimeHandler;
+    checkf(!LifetimeHandler->KeepsInstance(), TEXT("ResolveActors requires Transient registration. %s is registered as %s"), *Type->GetName(), LifetimeHandler->GetName());
+
+    // same bookkeeping as ResolveImpl does for each created instance, whole batch is measured as a single step
+    UnrealDI_Impl::FCreationFrame*& CreationChain = Container->GetRootContainer().CreationChain;
+    if (CreationChain != nullptr)
+    {
+        LifetimeHandler->AddDependent(CreationChain->Lifetime);
+        CreationChain->Lifetime->bReceivedUnsharedDependencies = true;
+    }
+
+    if (Container->bRecordingWarmUp)
+    {
+        Container->RecordWarmUpEntry(*Resolver);
+    }
+
+    UnrealDI_Impl::FSlowResolveDetector::FScope SlowResolveScope(*LifetimeHandler, Type);
+    UnrealDI_Impl::FCreationScope CreationScope(CreationChain, LifetimeHandler);
+
+    UClass* EffectiveClass = Resolver->EffectiveClass.LoadSynchronous();
+    checkf(EffectiveClass != nullptr && EffectiveClass->IsChildOf<AActor>(), TEXT("ResolveActors requires actor class, got %s"), *GetNameSafe(EffectiveClass));
+    SlowResolveScope.MarkLoaded(EffectiveClass);
+
+    IInstanceFactory* Factory = Container->FindInstanceFactory(EffectiveClass);
+    const bool bDefaultFactory = Factory == static_cast<IInstanceFactory*>(GetMutableDefault<UDefaultInstanceFactory>());
+
+    const int32 Count = Transforms.Num();
+
+    // Data will be owned by TObjectsCollection and freed by it
+    UObject** Data = (UObject**)FMemory::Malloc(Count * sizeof(UObject*));
+
+    // spawn at final transforms, so actors are never moved after registration of their components
+    for (int32 i = 0; i < Count; ++i)
+    {
+        Data[i] = Factory->CreateAt(Container->OuterForNewObjects, EffectiveClass, Transforms[i]);
+        checkf(Data[i] != nullptr, TEXT("IInstanceFactory must never return nullptr. Check project specific implementation"));
+    }
+    SlowResolveScope.MarkCreated(Factory);
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        Container->InjectObject(*Data[i]);
+
+        if (Container->InjectSubobjectsMode != EInjectSubobjects::None)
+        {
+            Container->InjectSubobjects(*Data[i], Container->InjectSubobjectsMode);
+        }
+    }
+    SlowResolveScope.MarkInjected();
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        AActor* Actor = CastChecked<AActor>(Data[i]);
+
+        if (bDefaultFactory)
+        {
+            // deferred spawn remembers its transform, FinishSpawning must receive the same one
+            UDefaultInstanceFactory::FinishSpawning(*Actor, Transforms[i]);
+        }
+        else
+        {
+            Factory->FinalizeCreation(Actor);
+        }
+
+        if (Container->InjectSubobjectsMode != EInjectSubobjects::None)
+        {
+            Container->InjectInstanceComponents(*Actor, Container->InjectSubobjectsMode);
+        }
+
+        LifetimeHandler->Set(Actor);
+
+        if (UnrealDI_Impl::FTransientChurnTracker::IsEnabled())
+        {
+            UnrealDI_Impl::FTransientChurnTracker::OnCreated(*Actor);
+        }
+    }
+    SlowResolveScope.MarkFinalized();
+
+    return TObjectsCollection<UObject>(Data, Count);
+}
+
+void UObjectContainer::StartRecordingWarmUp(double DurationSeconds)
+{
+    RecordedWarmUpEntries.Reset();
+    RecordedWarmUpKeys.Reset();
+    WarmUpRecordingEndTime = DurationSeconds > 0.0 ? FPlatformTime::Seconds() + DurationSeconds : 0.0;
+    bRecordingWarmUp = true;
+}
+
+void UObjectContainer::StopRecordingWarmUp(UObjectContainerWarmUpManifest& OutManifest)
+{
+    bRecordingWarmUp = false;
+
+    OutManifest.Entries = MoveTemp(RecordedWarmUpEntries);
+    OutManifest.MarkPackageDirty();
+
+    RecordedWarmUpEntries.Reset();
+    RecordedWarmUpKeys.Reset();
+}
+
+UE::Tasks::FTask UObjectContainer::WarmUp(const UObjectContainerWarmUpManifest& Manifest)
+{
+    check(IsInGameThread());
+
+    // request all classes at once, so their packages are loaded in parallel instead of one by one
+    TArray<FSoftObjectPath> ClassesToLoad;
+    for (const FObjectContainerWarmUpEntry& Entry : Manifest.Entries)
+    {
+        if (!Entry.EffectiveClass.IsNull() && Entry.EffectiveClass.Get() == nullptr)
+        {
+            ClassesToLoad.Add(Entry.EffectiveClass.ToSoftObjectPath());
+        }
+    }
+
+    if (ClassesToLoad.Num() == 0)
+    {
+        return CreateWarmUpInstances(Manifest.Entries);
+    }
+
+    // loading does not block game thread. event completes once instances are created, even if container is gone by then
+    UE::Tasks::FTaskEvent WarmedUp(UE_SOURCE_LOCATION);
+
+    UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(ClassesToLoad), FStreamableDelegate::CreateLambda(
+        [WeakThis = TWeakObjectPtr<UObjectContainer>(this), Entries = Manifest.Entries, WarmedUp]() mutable
+        {
+            UObjectContainer* Container = WeakThis.Get();
+            if (Container != nullptr && !Container->bShutDown)
+            {
+                WarmedUp.AddPrerequisites(Container->CreateWarmUpInstances(Entries));
+            }
+
+            WarmedUp.Trigger();
+        }));
+
+    return UE::Tasks::Launch(UE_SOURCE_LOCATION, [] {}, UE::Tasks::Prerequisites(WarmedUp), UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::Inline);
+}
+
+UE::Tasks::FTask UObjectContainer::CreateWarmUpInstances(TConstArrayView<FObjectContainerWarmUpEntry> Entries)
+{
+    TArray<const UObject*> CreatedInstances;
+
+    for (const FObjectContainerWarmUpEntry& Entry : Entries)
+    {
+        if (UClass* EffectiveClass = Entry.EffectiveClass.Get())
+        {
+            WarmedUpClasses.Add(EffectiveClass);
+        }
+
+        UClass* Interface = Entry.Interface.Get();
+        if (!Entry.bShared || Interface == nullptr)
+        {
+            continue;
+        }
+
+        // registrations of this container override parent ones, same as for Resolve. if none is found, configuration has changed since manifest was recorded
+        for (const UObjectContainer* Container = this; Container != nullptr; Container = Container->ParentContainer)
+        {
+            const FResolversArray* Resolvers = Container->Registrations.Find(Interface);
+            if (Resolvers == nullptr)
+            {
+                continue;
+            }
+
+            const FResolver* Resolver = Resolvers->FindByPredicate([&](const FResolver& Candidate)
+            {
+                return Candidate.EffectiveClass == Entry.EffectiveClass && Candidate.LifetimeHandler->IsShared();
+            });
+
+            if (Resolver != nullptr)
+            {
+                // asynchronous InitDependencies only start here, so we do not wait for them before creating next instance
+                CreatedInstances.Add(ResolveImpl(*Resolver, Container));
+            }
+
+            break;
+        }
+    }
+
+    return FInitReadiness::WhenAllReady(CreatedInstances);
+}
+
+void UObjectContainer::RecordWarmUpEntry(const FResolver& Resolver) const
+{
+    UObjectContainer* MutableThis = const_cast<UObjectContainer*>(this);
+
+    if (WarmUpRecordingEndTime > 0.0 && FPlatformTime::Seconds() > WarmUpRecordingEndTime)
+    {
+        MutableThis->bRecordingWarmUp = false;
+        return;
+    }
+
+    if (Resolver.EffectiveClass.IsNull())
+    {
+        // registrations without EffectiveClass are never created by container, there is nothing to warm up
+        return;
+    }
+
+    bool bAlreadyRecorded = false;
+    MutableThis->RecordedWarmUpKeys.Add(MakeTuple(Resolver.Interface, Resolver.EffectiveClass.ToSoftObjectPath()), &bAlreadyRecorded);
+
+    if (!bAlreadyRecorded)
+    {
+        FObjectContainerWarmUpEntry& Entry = MutableThis->RecordedWarmUpEntries.Emplace_GetRef();
+        Entry.Interface = TSoftClassPtr<UObject>(Resolver.Interface);
+        Entry.EffectiveClass = Resolver.EffectiveClass;
+        Entry.bShared = Resolver.LifetimeHandler->IsShared();
+    }
+}
+
+bool UObjectContainer::ReplaceRegistration(UClass* Interface, TSoftClassPtr<UObject> Implementation, bool bRecreateShared)
+{
+    using namespace UnrealDI_Impl;
+
+    checkf(Interface, TEXT("Requested replacement of null type"));
+    checkf(!Implementation.IsNull(), TEXT("Replacement of %s must not be null"), *Interface->GetName());
+
+    FResolversArray* Resolvers = Registrations.Find(Interface);
+    if (Resolvers == nullptr)
+    {
+        UE_LOG(LogUnrealDI, Warning, TEXT("Cannot replace %s: it is not registered in this container"), *Interface->GetName());
+        return false;
+    }
+
+    const TSharedRef<FLifetimeHandler> LifetimeHandler = Resolvers->Last().LifetimeHandler;
+
+    if (UClass* ImplementationClass = Implementation.Get())
+    {
+        bool bImplementsAll = true;
+        ForEachResolver([&](const FResolver& Resolver)
+        {
+            if (Resolver.LifetimeHandler == LifetimeHandler)
+            {
+                bImplementsAll &= Resolver.Interface->IsChildOf<UInterface>()
+                    ? ImplementationClass->ImplementsInterface(Resolver.Interface)
+                    : ImplementationClass->IsChildOf(Resolver.Interface);
+            }
+        });
+
+        if (!ensureMsgf(bImplementsAll, TEXT("%s cannot replace %s: it does not implement all interfaces of the registration"), *ImplementationClass->GetName(), *Interface->GetName()))
+        {
+            return false;
+        }
+    }
+
+    if (!LifetimeHandler->Release())
+    {
+        UE_LOG(LogUnrealDI, Warning, TEXT("Cannot replace %s: %s registrations do not create instances"), *Interface->GetName(), LifetimeHandler->GetName());
+        return false;
+    }
+
+    // switch all interfaces of the registration. typed creator and inject function were found for old class, so new one goes through instance factories
+    ForEachResolver([&](FResolver& Resolver)
+    {
+        if (Resolver.LifetimeHandler == LifetimeHandler)
+        {
+            Resolver.EffectiveClass = Implementation;
+            Resolver.TypedCreator = nullptr;
+            Resolver.InjectFunction = nullptr;
+        }
+    });
+
+    // release everything that received old instance, directly or through other registrations
+    TArray<TSharedRef<FLifetimeHandler>> Released;
+    Released.Add(LifetimeHandler);
+    ReleaseDependents(Released);
+
+    if (bRecreateShared)
+    {
+        // dependencies are released before their dependents, and each resolve creates its own dependencies first anyway
+        for (const TSharedRef<FLifetimeHandler>& Lifetime : Released)
+        {
+            if (Lifetime->IsShared() && Lifetime->Peek() == nullptr)
+            {
+                const auto [Resolver, Container] = FindResolverByLifetime(*Lifetime);
+                if (Resolver != nullptr)
+                {
+                    ResolveImpl(*Resolver, Container);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void UObjectContainer::ReleaseDependents(TArray<TSharedRef<UnrealDI_Impl::FLifetimeHandler>>& InOutReleased)
+{
+    using namespace UnrealDI_Impl;
+
+    // released lifetimes record their dependents again when recreated. dependencies are always listed before their dependents
+    for (int32 Index = 0; Index < InOutReleased.Num(); ++Index)
+    {
+        const TMap<const FLifetimeHandler*, TWeakPtr<FLifetimeHandler>> Dependents = MoveTemp(InOutReleased[Index]->Dependents);
+
+        for (const auto& [Key, WeakDependent] : Dependents)
+        {
+            const TSharedPtr<FLifetimeHandler> Dependent = WeakDependent.Pin();
+            if (Dependent.IsValid() && !InOutReleased.Contains(Dependent.ToSharedRef()) && Dependent->Release())
+            {
+                InOutReleased.Add(Dependent.ToSharedRef());
+            }
+        }
+    }
+}
+
+void UObjectContainer::Rebind(UObject* NewOuterForNewObjects)
+{
+    using namespace UnrealDI_Impl;
+
+    check(IsInGameThread());
+    checkf(NewOuterForNewObjects, TEXT("Container must be rebound to valid Outer"));
+    checkf(!bShutDown, TEXT("Container that was shut down can not be rebound"));
+
+    UObject* OldOuter = OuterForNewObjects;
+    UWorld* NewWorld = NewOuterForNewObjects->GetWorld();
+
+    // GetWorld of GameInstance already returns new World here, so old one is taken from outer chains
+    UWorld* OldWorld = OldOuter ? (OldOuter->IsA<UWorld>() ? CastChecked<UWorld>(OldOuter) : OldOuter->GetTypedOuter<UWorld>()) : nullptr;
+    if (OldWorld == nullptr)
+    {
+        OldWorld = GetTypedOuter<UWorld>();
+    }
+
+    auto IsWorldBound = [NewWorld](const UObject& Instance)
+    {
+        const UWorld* InstanceWorld = Instance.GetTypedOuter<UWorld>();
+        return Instance.IsA<AActor>() || Instance.IsA<UUserWidget>() || (InstanceWorld != nullptr && InstanceWorld != NewWorld);
+    };
+
+    // nested containers that create objects in the same Outer move together with this one
+    for (const TWeakObjectPtr<UObjectContainer>& Nested : NestedContainers)
+    {
+        if (UObjectContainer* NestedContainer = Nested.Get(); NestedContainer != nullptr && NestedContainer->OuterForNewObjects == OldOuter)
+        {
+            NestedContainer->Rebind(NewOuterForNewObjects);
+        }
+    }
+
+    // world-bound instances, and everything that received them, are created again in new world on next resolve
+    TArray<TSharedRef<FLifetimeHandler>> Released;
+    for (const FCreatedSharedLifetime& Created : CreatedSharedLifetimes)
+    {
+        const TSharedPtr<FLifetimeHandler> Lifetime = PinCurrent(Created);
+        UObject* Instance = Lifetime.IsValid() ? Lifetime->Peek() : nullptr;
+
+        if (Instance != nullptr && IsWorldBound(*Instance) && Lifetime->Release())
+        {
+            Released.Add(Lifetime.ToSharedRef());
+        }
+    }
+
+    ReleaseDependents(Released);
+
+    CreatedSharedLifetimes.RemoveAll([](const FCreatedSharedLifetime& Created)
+    {
+        const TSharedPtr<FLifetimeHandler> Lifetime = PinCurrent(Created);
+        return !Lifetime.IsValid() || Lifetime->Peek() == nullptr;
+    });
+    NumCompactedSharedLifetimes = CreatedSharedLifetimes.Num();
+
+    // subsystems are looked up again, per-frame and prototype state is cheap to create again
+    ForEachResolver([](FResolver& Resolver)
+    {
+        Resolver.LifetimeHandler->OnOuterChanged();
+
+        if (!Resolver.LifetimeHandler->IsShared())
+        {
+            Resolver.LifetimeHandler->Release();
+        }
+    });
+
+    OuterForNewObjects = NewOuterForNewObjects;
+
+    // container outered to old world would keep it from being collected
+    if (OldWorld != nullptr && OldWorld != NewWorld && IsIn(OldWorld))
+    {
+        UObject* NewOuter = NewWorld ? static_cast<UObject*>(NewWorld) : NewOuterForNewObjects;
+        Rename(*MakeUniqueObjectName(NewOuter, GetClass(), GetFName()).ToString(), NewOuter, REN_DontCreateRedirectors | REN_NonTransactional | REN_DoNotDirty);
+    }
+
+    if (OldWorld != nullptr && OldWorld != NewWorld && FInjectOnConstruction::GetContainerForWorld(OldWorld) == this)
+    {
+        FInjectOnConstruction::ClearContainerForWorld(OldWorld);
+
+        if (NewWorld != nullptr)
+        {
+            FInjectOnConstruction::SetContainerForWorld(NewWorld, this);
+        }
+    }
+
+    UE_LOG(LogUnrealDI, Log, TEXT("%s rebound to %s, released %d instances"), *GetName(), *NewOuterForNewObjects->GetName(), Released.Num());
+}
+
+void UObjectContainer::Shutdown(bool bMarkInstancesAsGarbage)
+{
+    check(IsInGameThread());
+
+    if (bShutDown)
+    {
+        return;
+    }
+
+    bShutDown = true;
+
+    ShutdownNestedContainers(bMarkInstancesAsGarbage);
+
+    const int32 NumReleased = ReleaseCreatedInstances(bMarkInstancesAsGarbage);
+    UE_LOG(LogUnrealDI, Log, TEXT("%s released %d instances on shutdown"), *GetName(), NumReleased);
+
+    Registrations.Empty();
+    KeyedRegistrations.Empty();
+    NativeRegistrations.Empty();
+    ObjectsMapIndices.Empty();
+    InstanceFactories.Empty();
+    WarmedUpClasses.Empty();
+
+    FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+    MemoryTrimHandle.Reset();
+
+    DetachFromParent();
+}
+
+bool UObjectContainer::IsShutDown() const
+{
+    // container resolves through its parents, so it is unusable once any of them is shut down
+    for (const UObjectContainer* Container = this; Container != nullptr; Container = Container->ParentContainer)
+    {
+        if (Container->bShutDown)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void UObjectContainer::ShutdownNestedContainers(bool bMarkInstancesAsGarbage)
+{
+    // nested containers resolve from this one, so they go first. newest nested container goes first too
+    const TArray<TWeakObjectPtr<UObjectContainer>> Nested = MoveTemp(NestedContainers);
+    for (int32 Index = Nested.Num() - 1; Index >= 0; --Index)
+    {
+        if (UObjectContainer* NestedContainer = Nested[Index].Get())
+        {
+            NestedContainer->Shutdown(bMarkInstancesAsGarbage);
+            NestedContainer->MarkAsGarbage();
+        }
+    }
+}
+
+int32 UObjectContainer::ReleaseCreatedInstances(bool bMarkInstancesAsGarbage)
+{
+    using namespace UnrealDI_Impl;
+
+    TArray<UObject*> ReleasedInstances;
+    for (int32 Index = CreatedSharedLifetimes.Num() - 1; Index >= 0; --Index)
+    {
+        const TSharedPtr<FLifetimeHandler> Lifetime = PinCurrent(CreatedSharedLifetimes[Index]);
+
+        UObject* Instance = Lifetime.IsValid() ? Lifetime->Peek() : nullptr;
+        if (Instance == nullptr)
+        {
+            continue;
+        }
+
+        if (IDisposable* Disposable = Cast<IDisposable>(Instance))
+        {
+            Disposable->Dispose();
+        }
+
+        if (Lifetime->Release())
+        {
+            ReleasedInstances.Add(Instance);
+        }
+    }
+
+    CreatedSharedLifetimes.Reset();
+    NumCompactedSharedLifetimes = 0;
+
+    if (bMarkInstancesAsGarbage)
+    {
+        for (UObject* Instance : ReleasedInstances)
+        {
+            if (AActor* Actor = Cast<AActor>(Instance))
+            {
+                Actor->Destroy();
+            }
+            else
+            {
+                Instance->MarkAsGarbage();
+            }
+        }
+    }
+
+    return ReleasedInstances.Num();
+}
+
+void UObjectContainer::DetachFromParent()
+{
+    if (ParentContainer)
+    {
+        ParentContainer->NestedContainers.Remove(this);
+        ParentContainer = nullptr;
+    }
+}
+
+void UObjectContainer::ResetForReuse()
+{
+    check(IsInGameThread());
+    checkf(!bShutDown, TEXT("Container that was shut down can not be reused"));
+
+    ShutdownNestedContainers(false);
+    ReleaseCreatedInstances(false);
+
+    // per-instance state of other lifetimes (e.g. PerFrame, Prototype) was created from the old parent too
+    ForEachResolver([](FResolver& Resolver)
+    {
+        Resolver.LifetimeHandler->Release();
+        Resolver.LifetimeHandler->OnOuterChanged();
+        Resolver.LifetimeHandler->Dependents.Reset();
+    });
+
+    for (auto& NativeRegistration : NativeRegistrations)
+    {
+        NativeRegistration.Value->Release();
+    }
+
+    // maps may include parent's registrations, so they are built again for the next parent
+    ObjectsMapIndices.Reset();
+    WarmedUpClasses.Reset();
+    RecordedWarmUpEntries.Reset();
+    RecordedWarmUpKeys.Reset();
+    bRecordingWarmUp = false;
+
+    DetachFromParent();
+    OuterForNewObjects = nullptr;
+}
+
+void UObjectContainer::AttachToParent(UObjectContainer& Parent, UObject* InOuterForNewObjects, EInjectSubobjects InInjectSubobjectsMode)
+{
+    check(ParentContainer == nullptr);
+
+    ParentContainer = &Parent;
+    Parent.NestedContainers.RemoveAll([](const TWeakObjectPtr<UObjectContainer>& Nested) { return !Nested.IsValid(); });
+    Parent.NestedContainers.Add(this);
+
+    OuterForNewObjects = InOuterForNewObjects;
+    InjectSubobjectsMode = InInjectSubobjectsMode;
+
+    // new parent may bring its own instance factories
+    DisableTypedCreatorsForCustomFactories();
+}
+
+FObjectContainerTrimResult UObjectContainer::TrimMemory()
+{
+    FObjectContainerTrimResult Result;
+
+    auto TrimResolver = [&Result](const FResolver& Resolver)
+    {
+        if (UObject* Released = Resolver.LifetimeHandler->Trim())
+        {
+            ++Result.NumReleasedReferences;
+            Result.ReleasedReferencesBytes += Released->GetClass()->GetStructureSize() + Released->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+        }
+    };
+
+    for (auto& Resolvers : Registrations)
+    {
+        for (const FResolver& Resolver : Resolvers.Value)
+        {
+            TrimResolver(Resolver);
+        }
+    }
+
+    for (auto& KeyedResolver : KeyedRegistrations)
+    {
+        TrimResolver(KeyedResolver.Value);
+    }
+
+    Result.NumReleasedClassReferences = WarmedUpClasses.Num();
+    WarmedUpClasses.Empty();
+
+    // maps that were already resolved keep their own reference to index
+    ObjectsMapIndices.Empty();
+
+    return Result;
+}
+
+void UObjectContainer::PostInitProperties()
+{
+    Super::PostInitProperties();
+
+    if (!HasAnyFlags(RF_ClassDefaultObject))
+    {
+        MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddUObject(this, &ThisClass::OnMemoryTrim);
+    }
+}
+
+void UObjectContainer::BeginDestroy()
+{
+    FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+
+    Super::BeginDestroy();
+}
+
+void UObjectContainer::OnMemoryTrim()
+{
+    const FObjectContainerTrimResult Result = TrimMemory();
+
+    if (Result.NumReleasedReferences > 0 || Result.NumReleasedClassReferences > 0)
+    {
+        UE_LOG(LogUnrealDI, Log, TEXT("%s dropped references to %d instances (up to ~%.1f KB) and %d classes on memory trim"),
+            *GetPathName(), Result.NumReleasedReferences, Result.ReleasedReferencesBytes / 1024.0, Result.NumReleasedClassReferences);
+    }
+}
+
 void UObjectContainer::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
     UObjectContainer* Container = (UObjectContainer*)InThis;
@@ -311,6 +1489,11 @@ void UObjectContainer::AddReferencedObjects(UObject* InThis, FReferenceCollector
         }
     }
 
+    for (auto& KeyedResolver : Container->KeyedRegistrations)
+    {
+        KeyedResolver.Value.LifetimeHandler->AddReferencedObjects(Collector);
+    }
+
     for (auto& InstanceFactory : Container->InstanceFactories)
     {
         InstanceFactory.AddReferencedObjects(Collector);
@@ -321,3 +1504,8 @@ UObject* UObjectContainer::ResolveFromContext(const UObject& Context, UClass& Ty
 {
     return static_cast<const UObjectContainer&>(Context).Resolve(&Type);
 }
+
+UObject* UObjectContainer::ResolveKeyedFromContext(const UObject& Context, UClass& Type, FName Key)
+{
+    return static_cast<const UObjectContainer&>(Context).ResolveKeyed(&Type, Key);
+}
@@ -2,43 +2,219 @@
 
 #include "DI/ObjectContainerBuilder.h"
 #include "DI/ObjectContainer.h"
+#include "DI/ObjectContainerDefinition.h"
 #include "DI/Impl/DefaultInjectorProvider.h"
+#include "DI/Impl/PrototypeLifetime.h"
+#include "Async/Async.h"
+#include "Tasks/Task.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace UnrealDI_Impl
+{
+    /* Entry of definition asset with its registration types found and checked on game thread */
+    struct FDefinitionRegistration
+    {
+        FObjectContainerDefinitionEntry Entry;
+
+        // interfaces listed in Entry, or its implementation class if it lists none
+        TArray<UClass*, TInlineAllocator<2>> Types;
+    };
+
+    static TSharedRef<FLifetimeHandler> MakeLifetimeHandler(const FObjectContainerDefinitionEntry& Entry)
+    {
+        switch (Entry.Lifetime)
+        {
+        case EObjectContainerLifetime::SingleInstance:
+            return MakeShared<FLifetimeHandler_SingleInstance>();
+        case EObjectContainerLifetime::WeakSingleInstance:
+            return MakeShared<FLifetimeHandler_WeakSingleInstance>();
+        case EObjectContainerLifetime::KeepAliveSingleInstance:
+            if (!ensureMsgf(Entry.KeepAliveSeconds > 0.f || Entry.KeepAliveGCCycles > 0, TEXT("KeepAliveSingleInstance requires KeepAliveSeconds or KeepAliveGCCycles")))
+            {
+                return MakeShared<FLifetimeHandler_WeakSingleInstance>();
+            }
+            return MakeShared<FLifetimeHandler_KeepAliveSingleInstance>(Entry.KeepAliveSeconds, Entry.KeepAliveGCCycles);
+        case EObjectContainerLifetime::PerFrame:
+            return MakeShared<FLifetimeHandler_PerFrame>();
+        case EObjectContainerLifetime::Prototype:
+            return FLifetimeHandler_Prototype::Make();
+        default:
+            return FLifetimeHandler_Transient::Make();
+        }
+    }
+}
+
+struct FObjectContainerBuilder::FCompileInputs
+{
+    TSoftClassPtr<UObject> DefaultInjectorProviderClass;
+    TArray<UnrealDI_Impl::FDefinitionRegistration> DefinitionRegistrations;
+};
 
 UObjectContainer* FObjectContainerBuilder::Build(UObject* Outer)
 {
     UObjectContainer* Container = Outer ? NewObject<UObjectContainer>(Outer) : NewObject<UObjectContainer>();
     Container->OuterForNewObjects = OuterForNewObjects ? OuterForNewObjects : Container->GetOuter();
+    Container->InjectSubobjectsMode = InjectSubobjectsMode.Get(EInjectSubobjects::None);
 
-    AddRegistrationsToContainer(Container);
+    UnrealDI_Impl::FRegistrationTables Tables;
+    CompileRegistrations(Tables, true, GatherCompileInputs(true));
+    PublishContainer(Container, MoveTemp(Tables));
 
     return Container;
 }
 
 UObjectContainer* FObjectContainerBuilder::BuildNested(UObjectContainer& Parent)
 {
-    UObjectContainer* Container = NewObject<UObjectContainer>(&Parent);
-    Container->OuterForNewObjects = OuterForNewObjects ? OuterForNewObjects : Parent.OuterForNewObjects.Get();
+    return BuildNested(NewObject<UObjectContainer>(&Parent), Parent, nullptr);
+}
+
+UObjectContainer* FObjectContainerBuilder::BuildNested(UObjectContainer* Container, UObjectContainer& Parent, UObject* OuterOverride) const
+{
+    Container->OuterForNewObjects = OuterOverride ? OuterOverride : OuterForNewObjects ? OuterForNewObjects : Parent.OuterForNewObjects.Get();
     Container->ParentContainer = &Parent;
+    Parent.NestedContainers.RemoveAll([](const TWeakObjectPtr<UObjectContainer>& Nested) { return !Nested.IsValid(); });
+    Parent.NestedContainers.Add(Container);
+    Container->InjectSubobjectsMode = InjectSubobjectsMode.Get(Parent.InjectSubobjectsMode);
 
-    AddRegistrationsToContainer(Container);
+    UnrealDI_Impl::FRegistrationTables Tables;
+    CompileRegistrations(Tables, false, GatherCompileInputs(true));
+    PublishContainer(Container, MoveTemp(Tables));
 
     return Container;
 }
 
+void FObjectContainerBuilder::BuildAsync(UObject* Outer, TFunction<void(UObjectContainer*)> OnBuilt) const
+{
+    check(IsInGameThread());
+
+    // copy of the builder keeps all configurators alive, so this builder may be destroyed right away
+    TSharedRef<const FObjectContainerBuilder> Builder = MakeShared<FObjectContainerBuilder>(*this);
+    TWeakObjectPtr<UObject> WeakOuter = Outer;
+    const bool bHasOuter = Outer != nullptr;
+
+    // soft class pointers can be resolved only on game thread. loading is not done here, classes must be loaded beforehand
+    TSharedRef<FCompileInputs> Inputs = MakeShared<FCompileInputs>(GatherCompileInputs(false));
+
+    // nothing else references definitions and their classes while tables are compiled. released on game thread once container is published
+    TArray<TStrongObjectPtr<UObject>> KeepAlive;
+    for (const UObjectContainerDefinition* Definition : Definitions)
+    {
+        KeepAlive.Emplace(const_cast<UObjectContainerDefinition*>(Definition));
+    }
+    for (const UnrealDI_Impl::FDefinitionRegistration& Registration : Inputs->DefinitionRegistrations)
+    {
+        for (UClass* Type : Registration.Types)
+        {
+            KeepAlive.Emplace(Type);
+        }
+    }
+
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [Builder, WeakOuter, bHasOuter, Inputs, KeepAlive = MoveTemp(KeepAlive), OnBuilt = MoveTemp(OnBuilt)]() mutable
+    {
+        TSharedRef<UnrealDI_Impl::FRegistrationTables> Tables = MakeShared<UnrealDI_Impl::FRegistrationTables>();
+        Builder->CompileRegistrations(*Tables, true, *Inputs);
+
+        AsyncTask(ENamedThreads::GameThread, [Builder, WeakOuter, bHasOuter, Tables, KeepAlive = MoveTemp(KeepAlive), OnBuilt = MoveTemp(OnBuilt)]()
+        {
+            UObject* Outer = WeakOuter.Get();
+            if (bHasOuter && Outer == nullptr)
+            {
+                // Outer was destroyed while tables were compiled
+                OnBuilt(nullptr);
+                return;
+            }
+
+            UObjectContainer* Container = Outer ? NewObject<UObjectContainer>(Outer) : NewObject<UObjectContainer>();
+            Container->OuterForNewObjects = Builder->OuterForNewObjects ? Builder->OuterForNewObjects : Container->GetOuter();
+            Container->InjectSubobjectsMode = Builder->InjectSubobjectsMode.Get(EInjectSubobjects::None);
+
+            Builder->PublishContainer(Container, MoveTemp(*Tables));
+
+            OnBuilt(Container);
+        });
+    });
+}
+
 void FObjectContainerBuilder::SetOuterForNewObjects(UObject* Outer)
 {
     OuterForNewObjects = Outer;
 }
 
-void FObjectContainerBuilder::AddRegistrationsToContainer(UObjectContainer* Container)
+void FObjectContainerBuilder::SetInjectSubobjects(EInjectSubobjects Mode)
+{
+    InjectSubobjectsMode = Mode;
+}
+
+void FObjectContainerBuilder::RegisterDefinition(const UObjectContainerDefinition& Definition)
+{
+    Definitions.Add(&Definition);
+}
+
+FObjectContainerBuilder::FCompileInputs FObjectContainerBuilder::GatherCompileInputs(bool bLoad) const
+{
+    using namespace UnrealDI_Impl;
+
+    check(IsInGameThread());
+
+    FCompileInputs Inputs;
+    Inputs.DefaultInjectorProviderClass = UDefaultInjectorProvider::StaticClass();
+
+    for (const UObjectContainerDefinition* Definition : Definitions)
+    {
+        for (const FObjectContainerDefinitionEntry& Entry : Definition->Entries)
+        {
+            if (!ensureMsgf(!Entry.Implementation.IsNull(), TEXT("Registration in %s has no Implementation"), *Definition->GetPathName()))
+            {
+                continue;
+            }
+
+            // registration without interfaces is keyed by its class, so it has to be loaded now. use LoadClassesAsync to avoid this
+            UClass* ImplClass = bLoad && Entry.Interfaces.Num() == 0 ? Entry.Implementation.LoadSynchronous() : Entry.Implementation.Get();
+
+            FDefinitionRegistration Registration{ Entry };
+
+            if (Entry.Interfaces.Num() == 0)
+            {
+                // BuildAsync does not load classes, so they must be loaded beforehand
+                if (!ensureMsgf(ImplClass != nullptr, TEXT("Failed to load %s listed in %s"), *Entry.Implementation.ToString(), *Definition->GetPathName()))
+                {
+                    continue;
+                }
+
+                Registration.Types.Add(ImplClass);
+            }
+
+            for (UClass* Interface : Entry.Interfaces)
+            {
+                if (Interface == nullptr)
+                {
+                    continue;
+                }
+
+                if (ImplClass != nullptr)
+                {
+                    ensureMsgf(ImplClass->ImplementsInterface(Interface), TEXT("%s listed in %s does not implement %s"), *ImplClass->GetName(), *Definition->GetPathName(), *Interface->GetName());
+                }
+
+                Registration.Types.Add(Interface);
+            }
+
+            Inputs.DefinitionRegistrations.Add(MoveTemp(Registration));
+        }
+    }
+
+    return Inputs;
+}
+
+void FObjectContainerBuilder::CompileRegistrations(UnrealDI_Impl::FRegistrationTables& Tables, bool bRootContainer, const FCompileInputs& Inputs) const
 {
     using namespace UnrealDI_Impl;
 
-    if (Container->ParentContainer == nullptr)
+    if (bRootContainer)
     {
         // add default InjectorProvider before user provided registrations so it may be overriden.
         // add only in Root container, so user doesn't have to add override in each nested container
-        Container->AddRegistration(UInjectorProvider::StaticClass(), UDefaultInjectorProvider::StaticClass(), MakeShared<FLifetimeHandler_WeakSingleInstance>());
+        Tables.AddRegistration(UInjectorProvider::StaticClass(), Inputs.DefaultInjectorProviderClass, MakeShared<FLifetimeHandler_WeakSingleInstance>());
     }
 
     // add user provided registrations
@@ -46,18 +222,78 @@ void FObjectContainerBuilder::AddRegistrationsToContainer(UObjectContainer* Cont
     {
         TSharedRef<FLifetimeHandler> LifetimeHandler = Registration->CreateLifetimeHandler();
 
+        // typed creator knows only about registered class itself, not about its blueprint subclasses
+        const FTypedInstanceCreator* SelfTypedCreator = Registration->EffectiveClassPtr == Registration->ImplClassPtr ? Registration->TypedCreator : nullptr;
+
+        // keyed registrations are stored separately, so they never participate in plain Resolve or ResolveAll
+        if (!Registration->Key.IsNone())
+        {
+            if (Registration->InterfaceTypes.Num() == 0)
+            {
+                Tables.AddKeyedRegistration(Registration->ImplClass, Registration->Key, Registration->EffectiveClassPtr, LifetimeHandler, SelfTypedCreator);
+            }
+
+            for (UClass* Interface : Registration->InterfaceTypes)
+            {
+                Tables.AddKeyedRegistration(Interface, Registration->Key, Registration->ImplClassPtr, LifetimeHandler, Registration->TypedCreator);
+            }
+
+            continue;
+        }
+
         // if no interface types declared, register as itself
         if (Registration->InterfaceTypes.Num() == 0)
         {
-            Container->AddRegistration(Registration->ImplClass, Registration->EffectiveClassPtr, LifetimeHandler);
+            Tables.AddRegistration(Registration->ImplClass, Registration->EffectiveClassPtr, LifetimeHandler, SelfTypedCreator);
         }
 
         // register all interfaces that this type implements
         for (UClass* Interface : Registration->InterfaceTypes)
         {
-            Container->AddRegistration(Interface, Registration->ImplClass, LifetimeHandler);
+            Tables.AddRegistration(Interface, Registration->ImplClassPtr, LifetimeHandler, Registration->TypedCreator);
+        }
+    }
+
+    // add registrations from definition assets
+    CompileDefinitions(Tables, Inputs);
+
+    // add user provided native registrations
+    for (auto& NativeRegistration : NativeRegistrations)
+    {
+        Tables.AddNativeRegistration(NativeRegistration->TypeKey, NativeRegistration->LifetimeHandlerFactory());
+    }
+}
+
+void FObjectContainerBuilder::CompileDefinitions(UnrealDI_Impl::FRegistrationTables& Tables, const FCompileInputs& Inputs) const
+{
+    using namespace UnrealDI_Impl;
+
+    Tables.Registrations.Reserve(Tables.Registrations.Num() + Inputs.DefinitionRegistrations.Num());
+
+    for (const FDefinitionRegistration& Registration : Inputs.DefinitionRegistrations)
+    {
+        const FObjectContainerDefinitionEntry& Entry = Registration.Entry;
+        TSharedRef<FLifetimeHandler> LifetimeHandler = MakeLifetimeHandler(Entry);
+
+        for (UClass* Type : Registration.Types)
+        {
+            if (Entry.Key.IsNone())
+            {
+                Tables.AddRegistration(Type, Entry.Implementation, LifetimeHandler);
+            }
+            else
+            {
+                Tables.AddKeyedRegistration(Type, Entry.Key, Entry.Implementation, LifetimeHandler);
+            }
         }
     }
+}
+
+void FObjectContainerBuilder::PublishContainer(UObjectContainer* Container, UnrealDI_Impl::FRegistrationTables&& Tables) const
+{
+    using namespace UnrealDI_Impl;
+
+    Container->AttachRegistrationTables(MoveTemp(Tables));
 
     // register container itself as IResolver
     Container->AddRegistration(UResolver::StaticClass(), {}, MakeShared<FLifetimeHandler_Instance>(Container));
@@ -68,13 +304,57 @@ void FObjectContainerBuilder::AddRegistrationsToContainer(UObjectContainer* Cont
     // finalize creation and let Container create its services
     Container->InitServices();
 
+    AutoCreate(Container);
+}
+
+void FObjectContainerBuilder::AutoCreate(UObjectContainer* Container) const
+{
     // resolve all classes that are marked with bAutoCreate
     for (auto& Registration : Registrations)
     {
         if (Registration->bAutoCreate)
         {
             UClass* ClassToResolve = Registration->InterfaceTypes.Num() > 0 ? Registration->InterfaceTypes[0] : Registration->ImplClass;
-            Container->Resolve(ClassToResolve);
+
+            if (Registration->Key.IsNone())
+            {
+                Container->Resolve(ClassToResolve);
+            }
+            else
+            {
+                Container->ResolveKeyed(ClassToResolve, Registration->Key);
+            }
+        }
+    }
+
+    AutoCreateDefinitions(Container);
+}
+
+void FObjectContainerBuilder::AutoCreateDefinitions(UObjectContainer* Container) const
+{
+    for (const UObjectContainerDefinition* Definition : Definitions)
+    {
+        for (const FObjectContainerDefinitionEntry& Entry : Definition->Entries)
+        {
+            if (!Entry.bAutoCreate)
+            {
+                continue;
+            }
+
+            UClass* ClassToResolve = Entry.Interfaces.Num() > 0 ? Entry.Interfaces[0].Get() : Entry.Implementation.Get();
+            if (ClassToResolve == nullptr)
+            {
+                continue;
+            }
+
+            if (Entry.Key.IsNone())
+            {
+                Container->Resolve(ClassToResolve);
+            }
+            else
+            {
+                Container->ResolveKeyed(ClassToResolve, Entry.Key);
+            }
         }
     }
 }
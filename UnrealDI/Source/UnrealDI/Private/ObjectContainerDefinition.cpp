@@ -0,0 +1,26 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/ObjectContainerDefinition.h"
+#include "Engine/AssetManager.h"
+
+TSharedPtr<FStreamableHandle> UObjectContainerDefinition::LoadClassesAsync(FStreamableDelegate OnLoaded) const
+{
+    TArray<FSoftObjectPath> ClassesToLoad;
+    ClassesToLoad.Reserve(Entries.Num());
+
+    for (const FObjectContainerDefinitionEntry& Entry : Entries)
+    {
+        if (!Entry.Implementation.IsNull() && Entry.Implementation.Get() == nullptr)
+        {
+            ClassesToLoad.AddUnique(Entry.Implementation.ToSoftObjectPath());
+        }
+    }
+
+    if (ClassesToLoad.Num() == 0)
+    {
+        OnLoaded.ExecuteIfBound();
+        return nullptr;
+    }
+
+    return UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(ClassesToLoad), MoveTemp(OnLoaded));
+}
@@ -0,0 +1,81 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/ObjectContainerPool.h"
+#include "DI/ObjectContainer.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/Package.h"
+
+FObjectContainerPool::FObjectContainerPool(const FObjectContainerBuilder& InBuilder, int32 InMaxPooledContainers)
+    : Builder(InBuilder)
+    , MaxPooledContainers(InMaxPooledContainers)
+{
+    MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddRaw(this, &FObjectContainerPool::Empty);
+}
+
+FObjectContainerPool::~FObjectContainerPool()
+{
+    FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+}
+
+UObjectContainer* FObjectContainerPool::Acquire(UObjectContainer& Parent, UObject* OuterForNewObjects)
+{
+    check(IsInGameThread());
+
+    if (PooledContainers.Num() == 0)
+    {
+        // pooled containers move between parents, so they can't be outered to any of them
+        return Builder.BuildNested(NewObject<UObjectContainer>(GetTransientPackage()), Parent, OuterForNewObjects);
+    }
+
+    UObjectContainer* Container = PooledContainers.Pop();
+
+    UObject* Outer = OuterForNewObjects ? OuterForNewObjects : Builder.OuterForNewObjects ? Builder.OuterForNewObjects : Parent.OuterForNewObjects.Get();
+    Container->AttachToParent(Parent, Outer, Builder.InjectSubobjectsMode.Get(Parent.InjectSubobjectsMode));
+
+    Builder.AutoCreate(Container);
+
+    return Container;
+}
+
+void FObjectContainerPool::Release(UObjectContainer* Container)
+{
+    check(IsInGameThread());
+
+    // container is shut down together with its parent, nothing to reuse then
+    if (Container == nullptr || Container->IsShutDown())
+    {
+        return;
+    }
+
+    if (PooledContainers.Num() >= MaxPooledContainers)
+    {
+        Container->Shutdown();
+        Container->MarkAsGarbage();
+        return;
+    }
+
+    Container->ResetForReuse();
+    PooledContainers.Add(Container);
+}
+
+void FObjectContainerPool::Empty()
+{
+    for (UObjectContainer* Container : PooledContainers)
+    {
+        Container->Shutdown();
+        Container->MarkAsGarbage();
+    }
+
+    PooledContainers.Empty();
+}
+
+void FObjectContainerPool::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    Collector.AddReferencedObjects(PooledContainers);
+    Collector.AddReferencedObject(Builder.OuterForNewObjects);
+}
+
+FString FObjectContainerPool::GetReferencerName() const
+{
+    return TEXT("FObjectContainerPool");
+}
@@ -0,0 +1,41 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/Impl/PreparedInvocation.h"
+#include "DI/Impl/Lifetimes.h"
+#include "DI/ObjectContainer.h"
+
+UnrealDI_Impl::FPreparedResolver::FPreparedResolver(const UObjectContainer& InContainer)
+    : Container(&InContainer)
+{
+}
+
+const IResolver& UnrealDI_Impl::FPreparedResolver::Get() const
+{
+    const UObjectContainer* Resolver = Container.Get();
+    checkf(Resolver != nullptr && !Resolver->IsShutDown(), TEXT("Prepared invocation was called after its container was destroyed or shut down"));
+
+    return *Resolver;
+}
+
+UnrealDI_Impl::FPreparedObjectSlot::FPreparedObjectSlot(const UObjectContainer& Container, UClass* InType)
+    : Type(InType)
+    , SharedLifetime(Container.FindSharedLifetime(InType))
+{
+}
+
+UObject* UnrealDI_Impl::FPreparedObjectSlot::Get(const FPreparedResolver& Resolver) const
+{
+    // container is checked first, lifetime of a shut down container must not hand out its released instances
+    const IResolver& Container = Resolver.Get();
+
+    // lifetime may be released (e.g. by TrimMemory or ReplaceRegistration), then container creates instance again
+    if (TSharedPtr<FLifetimeHandler> Lifetime = SharedLifetime.Pin())
+    {
+        if (UObject* Instance = Lifetime->Get())
+        {
+            return Instance;
+        }
+    }
+
+    return Container.Resolve(Type);
+}
@@ -0,0 +1,40 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/Impl/PrototypeLifetime.h"
+#include "DI/InitReadiness.h"
+#include "GameFramework/Actor.h"
+#include "Blueprint/UserWidget.h"
+#include "UObject/Package.h"
+
+void UnrealDI_Impl::FLifetimeHandler_Prototype::Set(UObject* Object)
+{
+    checkf(!Object->IsA<AActor>() && !Object->IsA<UUserWidget>(), TEXT("Prototype lifetime does not support actors and widgets (%s)"), *Object->GetClass()->GetName());
+
+    if (Template != nullptr)
+    {
+        // instance was copied from template
+        return;
+    }
+
+    if (!FInitReadiness::IsReady(Object))
+    {
+        // asynchronous InitDependencies has not finished yet, copy would miss its results. next instance is created as usual again
+        return;
+    }
+
+    // keep a copy, so changes made to first instance by its user do not leak into later instances
+    Template = NewObject<UObject>(GetTransientPackage(), Object->GetClass(), NAME_None, RF_Transient, Object);
+}
+
+void UnrealDI_Impl::FLifetimeHandler_Prototype::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    Collector.AddReferencedObject(Template);
+}
+
+UObject* UnrealDI_Impl::FLifetimeHandler_Prototype::Trim()
+{
+    // template will be made again from next instance created by container
+    UObject* Released = Template;
+    Template = nullptr;
+    return Released;
+}
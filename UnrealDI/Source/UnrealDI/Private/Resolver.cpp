@@ -0,0 +1,23 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/IResolver.h"
+#include "DI/ObjectsMap.h"
+#include "UObject/Class.h"
+
+UObject* IResolver::ResolveKeyed(UClass* Type, FName Key) const
+{
+    UObject* Result = TryResolveKeyed(Type, Key);
+    checkf(Result != nullptr, TEXT("Type %s is not registered with key %s"), *GetNameSafe(Type), *Key.ToString());
+
+    return Result;
+}
+
+UObject* IResolver::TryResolveKeyed(UClass* Type, FName Key) const
+{
+    return nullptr;
+}
+
+TObjectsMap<FName, UObject> IResolver::ResolveMap(UClass* Type) const
+{
+    return TObjectsMap<FName, UObject>();
+}
@@ -0,0 +1,113 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "SlowResolveDetector.h"
+#include "UnrealDILog.h"
+#include "DI/IInstanceFactory.h"
+#include "DI/Impl/Lifetimes.h"
+#include "HAL/IConsoleManager.h"
+
+float UnrealDI_Impl::FSlowResolveDetector::ThresholdMs = 0.f;
+TArray<UnrealDI_Impl::FSlowResolveDetector::FStep> UnrealDI_Impl::FSlowResolveDetector::Steps;
+int32 UnrealDI_Impl::FSlowResolveDetector::CurrentDepth = 0;
+
+static FAutoConsoleVariableRef CVarSlowResolveThresholdMs(
+    TEXT("UnrealDI.SlowResolveThresholdMs"),
+    UnrealDI_Impl::FSlowResolveDetector::ThresholdMs,
+    TEXT("If greater than zero, any top level Resolve taking longer than this amount of milliseconds is logged together with all nested resolves it caused"),
+    ECVF_Default);
+
+int32 UnrealDI_Impl::FSlowResolveDetector::BeginStep(const FLifetimeHandler& LifetimeHandler, UClass* Interface)
+{
+    if (CurrentDepth == 0)
+    {
+        Steps.Reset();
+    }
+
+    FStep& Step = Steps.Emplace_GetRef();
+    Step.Depth = CurrentDepth;
+    Step.LifetimeName = LifetimeHandler.GetName();
+    Step.Interface = Interface;
+    Step.StartCycles = FPlatformTime::Cycles64();
+    Step.LastMarkCycles = Step.StartCycles;
+
+    ++CurrentDepth;
+
+    return Steps.Num() - 1;
+}
+
+void UnrealDI_Impl::FSlowResolveDetector::EndStep(int32 StepIndex)
+{
+    FStep& Step = Steps[StepIndex];
+    Step.TotalCycles = FPlatformTime::Cycles64() - Step.StartCycles;
+
+    --CurrentDepth;
+
+    if (CurrentDepth == 0 && FPlatformTime::ToMilliseconds64(Step.TotalCycles) > ThresholdMs)
+    {
+        LogChain();
+    }
+}
+
+void UnrealDI_Impl::FSlowResolveDetector::OnLoaded(int32 StepIndex, UClass* EffectiveClass)
+{
+    FStep& Step = Steps[StepIndex];
+    Step.EffectiveClass = EffectiveClass;
+    Step.LoadCycles = ConsumeMarkCycles(Step);
+}
+
+void UnrealDI_Impl::FSlowResolveDetector::OnCreated(int32 StepIndex, const IInstanceFactory* Factory)
+{
+    FStep& Step = Steps[StepIndex];
+    Step.FactoryClass = Factory ? Factory->_getUObject()->GetClass() : nullptr;
+    Step.CreateCycles = ConsumeMarkCycles(Step);
+}
+
+void UnrealDI_Impl::FSlowResolveDetector::OnInjected(int32 StepIndex)
+{
+    FStep& Step = Steps[StepIndex];
+    Step.InjectCycles = ConsumeMarkCycles(Step);
+}
+
+void UnrealDI_Impl::FSlowResolveDetector::OnFinalized(int32 StepIndex)
+{
+    FStep& Step = Steps[StepIndex];
+    Step.FinalizeCycles = ConsumeMarkCycles(Step);
+}
+
+uint64 UnrealDI_Impl::FSlowResolveDetector::ConsumeMarkCycles(FStep& Step)
+{
+    const uint64 Now = FPlatformTime::Cycles64();
+    const uint64 Result = Now - Step.LastMarkCycles;
+    Step.LastMarkCycles = Now;
+    return Result;
+}
+
+void UnrealDI_Impl::FSlowResolveDetector::LogChain()
+{
+    const FStep& Root = Steps[0];
+
+    UE_LOG(LogUnrealDI, Warning, TEXT("Resolve of %s [%s] took %.2f ms, which exceeds UnrealDI.SlowResolveThresholdMs (%.2f ms). Resolve chain:"),
+        *GetNameSafe(Root.Interface), Root.LifetimeName, FPlatformTime::ToMilliseconds64(Root.TotalCycles), ThresholdMs);
+
+    for (const FStep& Step : Steps)
+    {
+        // steps without EffectiveClass were served from lifetime without creating anything
+        if (Step.EffectiveClass == nullptr)
+        {
+            UE_LOG(LogUnrealDI, Warning, TEXT("  %s%s [%s] existing instance, total %.3f ms"),
+                *FString::ChrN(Step.Depth * 2, TEXT(' ')), *GetNameSafe(Step.Interface), Step.LifetimeName, FPlatformTime::ToMilliseconds64(Step.TotalCycles));
+            continue;
+        }
+
+        UE_LOG(LogUnrealDI, Warning, TEXT("  %s%s [%s] factory: %s, load: %.3f ms, create: %.3f ms, inject: %.3f ms, finalize: %.3f ms, total: %.3f ms"),
+            *FString::ChrN(Step.Depth * 2, TEXT(' ')),
+            *Step.EffectiveClass->GetName(),
+            Step.LifetimeName,
+            *GetNameSafe(Step.FactoryClass),
+            FPlatformTime::ToMilliseconds64(Step.LoadCycles),
+            FPlatformTime::ToMilliseconds64(Step.CreateCycles),
+            FPlatformTime::ToMilliseconds64(Step.InjectCycles),
+            FPlatformTime::ToMilliseconds64(Step.FinalizeCycles),
+            FPlatformTime::ToMilliseconds64(Step.TotalCycles));
+    }
+}
@@ -0,0 +1,113 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IInstanceFactory;
+
+namespace UnrealDI_Impl
+{
+    class FLifetimeHandler;
+
+    /*
+     * Measures every step of a resolve chain while UnrealDI.SlowResolveThresholdMs is greater than zero.
+     * When top level resolve exceeds the threshold, whole chain of nested resolves is written to log.
+     * When threshold is not set, the only cost is a check of a single static variable per resolve
+     */
+    class FSlowResolveDetector
+    {
+    public:
+        /* Tracks single step of a chain. Construct it on stack at the beginning of a resolve */
+        class FScope
+        {
+        public:
+            FScope(const FLifetimeHandler& LifetimeHandler, UClass* Interface)
+            {
+                if (IsEnabled())
+                {
+                    StepIndex = BeginStep(LifetimeHandler, Interface);
+                }
+            }
+
+            ~FScope()
+            {
+                if (StepIndex != INDEX_NONE)
+                {
+                    EndStep(StepIndex);
+                }
+            }
+
+            void MarkLoaded(UClass* EffectiveClass)
+            {
+                if (StepIndex != INDEX_NONE)
+                {
+                    OnLoaded(StepIndex, EffectiveClass);
+                }
+            }
+
+            void MarkCreated(const IInstanceFactory* Factory)
+            {
+                if (StepIndex != INDEX_NONE)
+                {
+                    OnCreated(StepIndex, Factory);
+                }
+            }
+
+            void MarkInjected()
+            {
+                if (StepIndex != INDEX_NONE)
+                {
+                    OnInjected(StepIndex);
+                }
+            }
+
+            void MarkFinalized()
+            {
+                if (StepIndex != INDEX_NONE)
+                {
+                    OnFinalized(StepIndex);
+                }
+            }
+
+        private:
+            int32 StepIndex = INDEX_NONE;
+        };
+
+        static bool IsEnabled() { return ThresholdMs > 0.f; }
+
+        /* Value of UnrealDI.SlowResolveThresholdMs console variable */
+        static float ThresholdMs;
+
+    private:
+        struct FStep
+        {
+            int32 Depth = 0;
+            const TCHAR* LifetimeName = nullptr;
+            UClass* Interface = nullptr;
+            UClass* EffectiveClass = nullptr;
+            UClass* FactoryClass = nullptr;
+            uint64 StartCycles = 0;
+            uint64 LastMarkCycles = 0;
+            uint64 LoadCycles = 0;
+            uint64 CreateCycles = 0;
+            uint64 InjectCycles = 0;
+            uint64 FinalizeCycles = 0;
+            uint64 TotalCycles = 0;
+        };
+
+        static int32 BeginStep(const FLifetimeHandler& LifetimeHandler, UClass* Interface);
+        static void EndStep(int32 StepIndex);
+
+        static void OnLoaded(int32 StepIndex, UClass* EffectiveClass);
+        static void OnCreated(int32 StepIndex, const IInstanceFactory* Factory);
+        static void OnInjected(int32 StepIndex);
+        static void OnFinalized(int32 StepIndex);
+
+        static uint64 ConsumeMarkCycles(FStep& Step);
+        static void LogChain();
+
+        static TArray<FStep> Steps;
+        static int32 CurrentDepth;
+    };
+}
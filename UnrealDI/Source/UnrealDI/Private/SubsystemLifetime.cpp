@@ -0,0 +1,92 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/Impl/SubsystemLifetime.h"
+#include "DI/ObjectContainer.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Subsystems/WorldSubsystem.h"
+
+UnrealDI_Impl::FLifetimeHandler_Subsystem::FLifetimeHandler_Subsystem(UClass* SubsystemClass)
+    : SubsystemClass(SubsystemClass)
+{
+}
+
+UnrealDI_Impl::FLifetimeHandler_Subsystem::~FLifetimeHandler_Subsystem()
+{
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+}
+
+void UnrealDI_Impl::FLifetimeHandler_Subsystem::OnAddedToContainer(const UObjectContainer& InContainer)
+{
+    Container = &InContainer;
+
+    // handler may be created on worker thread by BuildAsync, while delegates may be bound only on game thread.
+    // called once per interface of the registration
+    if (!WorldCleanupHandle.IsValid())
+    {
+        check(IsInGameThread());
+        WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FLifetimeHandler_Subsystem::OnWorldCleanup);
+    }
+}
+
+UObject* UnrealDI_Impl::FLifetimeHandler_Subsystem::Get()
+{
+    if (UObject* Subsystem = CachedSubsystem.Get())
+    {
+        return Subsystem;
+    }
+
+    UWorld* World = nullptr;
+    UObject* Subsystem = FindSubsystem(World);
+    checkf(Subsystem != nullptr, TEXT("Subsystem %s is not available. Make sure you provided valid Outer to FObjectContainerBuilder::Build"), *SubsystemClass->GetName());
+
+    CachedSubsystem = Subsystem;
+    CachedWorld = World;
+
+    return Subsystem;
+}
+
+UObject* UnrealDI_Impl::FLifetimeHandler_Subsystem::FindSubsystem(UWorld*& OutWorld) const
+{
+    checkf(Container != nullptr, TEXT("Subsystem registration was not added to container"));
+
+    UObject* Outer = Container->GetOuterForNewObjects();
+    OutWorld = Outer ? Outer->GetWorld() : nullptr;
+
+    if (SubsystemClass->IsChildOf<UWorldSubsystem>())
+    {
+        return OutWorld ? OutWorld->GetSubsystemBase(SubsystemClass) : nullptr;
+    }
+
+    if (SubsystemClass->IsChildOf<UGameInstanceSubsystem>())
+    {
+        UGameInstance* GameInstance = Cast<UGameInstance>(Outer);
+        if (GameInstance == nullptr && OutWorld != nullptr)
+        {
+            GameInstance = OutWorld->GetGameInstance();
+        }
+
+        return GameInstance ? GameInstance->GetSubsystemBase(SubsystemClass) : nullptr;
+    }
+
+    if (SubsystemClass->IsChildOf<UEngineSubsystem>())
+    {
+        return GEngine ? GEngine->GetEngineSubsystemBase(SubsystemClass) : nullptr;
+    }
+
+    checkf(false, TEXT("Subsystem class %s is not supported"), *SubsystemClass->GetName());
+    return nullptr;
+}
+
+void UnrealDI_Impl::FLifetimeHandler_Subsystem::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    // subsystems of this World (or its GameInstance, if session ended) are deinitialized, but may still be alive until next GC
+    if (CachedWorld.Get() == World)
+    {
+        CachedSubsystem.Reset();
+        CachedWorld.Reset();
+    }
+}
@@ -0,0 +1,155 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "TransientChurnTracker.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/UObjectGlobals.h"
+
+int32 UnrealDI_Impl::FTransientChurnTracker::SampleRate = 0;
+TMap<TWeakObjectPtr<UClass>, UnrealDI_Impl::FTransientChurnTracker::FClassStats> UnrealDI_Impl::FTransientChurnTracker::Stats;
+TArray<UnrealDI_Impl::FTransientChurnTracker::FSample> UnrealDI_Impl::FTransientChurnTracker::Samples;
+double UnrealDI_Impl::FTransientChurnTracker::TrackingStartTime = 0.0;
+FDelegateHandle UnrealDI_Impl::FTransientChurnTracker::PostGarbageCollectHandle;
+
+static FAutoConsoleVariableRef CVarTransientChurnSampleRate(
+    TEXT("UnrealDI.TransientChurnSampleRate"),
+    UnrealDI_Impl::FTransientChurnTracker::SampleRate,
+    TEXT("If greater than zero, container counts objects created for Transient registrations and tracks lifetime of every Nth of them. Use UnrealDI.ReportTransientChurn to see results"),
+    ECVF_Default);
+
+static FAutoConsoleCommandWithArgsAndOutputDevice CmdReportTransientChurn(
+    TEXT("UnrealDI.ReportTransientChurn"),
+    TEXT("Lists Transient registrations ranked by amount of objects created per second, with estimated allocation and GC cost. Optional argument limits amount of printed rows"),
+    FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&UnrealDI_Impl::FTransientChurnTracker::Report));
+
+static FAutoConsoleCommandWithArgsAndOutputDevice CmdResetTransientChurn(
+    TEXT("UnrealDI.ResetTransientChurn"),
+    TEXT("Clears data collected for UnrealDI.ReportTransientChurn"),
+    FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&UnrealDI_Impl::FTransientChurnTracker::Reset));
+
+void UnrealDI_Impl::FTransientChurnTracker::Init()
+{
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FTransientChurnTracker::PostGarbageCollect);
+}
+
+void UnrealDI_Impl::FTransientChurnTracker::Shutdown()
+{
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+    Stats.Empty();
+    Samples.Empty();
+}
+
+void UnrealDI_Impl::FTransientChurnTracker::OnCreated(UObject& Object)
+{
+    const double Now = FPlatformTime::Seconds();
+    if (TrackingStartTime == 0.0)
+    {
+        TrackingStartTime = Now;
+    }
+
+    UClass* Class = Object.GetClass();
+
+    FClassStats& ClassStats = Stats.FindOrAdd(Class);
+    if (ClassStats.NumCreated == 0)
+    {
+        ClassStats.ClassName = Class->GetName();
+        ClassStats.InstanceSize = Class->GetStructureSize();
+    }
+
+    if (ClassStats.NumCreated % SampleRate == 0)
+    {
+        Samples.Emplace(FSample{ &Object, Class, Now });
+    }
+
+    ++ClassStats.NumCreated;
+}
+
+void UnrealDI_Impl::FTransientChurnTracker::PostGarbageCollect()
+{
+    if (Samples.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+
+    for (auto It = Samples.CreateIterator(); It; ++It)
+    {
+        if (!It->Object.IsValid())
+        {
+            // object was collected by this GC. its actual lifetime may be a bit shorter, but GC is the moment when we pay for it
+            if (FClassStats* ClassStats = Stats.Find(It->Class))
+            {
+                ++ClassStats->NumSampledCollected;
+                ClassStats->SampledLifetimeSum += Now - It->CreationTime;
+            }
+
+            It.RemoveCurrentSwap();
+        }
+    }
+}
+
+void UnrealDI_Impl::FTransientChurnTracker::Report(const TArray<FString>& Args, FOutputDevice& Output)
+{
+    if (Stats.Num() == 0)
+    {
+        Output.Logf(TEXT("No transient objects were created while tracking. Set UnrealDI.TransientChurnSampleRate to a value greater than zero to start tracking"));
+        return;
+    }
+
+    const int32 MaxRows = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : MAX_int32;
+    const double TrackedSeconds = FMath::Max(FPlatformTime::Seconds() - TrackingStartTime, 0.001);
+
+    TArray<const FClassStats*> SortedStats;
+    for (const auto& Pair : Stats)
+    {
+        SortedStats.Add(&Pair.Value);
+    }
+
+    SortedStats.Sort([](const FClassStats& Lhs, const FClassStats& Rhs) { return Lhs.NumCreated > Rhs.NumCreated; });
+
+    Output.Logf(TEXT("Transient churn over %.1f s, lifetime sampled for every %d object:"), TrackedSeconds, SampleRate);
+    Output.Logf(TEXT("%-48s %10s %10s %14s %10s %12s  %s"), TEXT("Class"), TEXT("Created"), TEXT("Per sec"), TEXT("Avg lifetime"), TEXT("Avg alive"), TEXT("Alloc KB/s"), TEXT("Hint"));
+
+    for (int32 Index = 0; Index < SortedStats.Num() && Index < MaxRows; ++Index)
+    {
+        const FClassStats& ClassStats = *SortedStats[Index];
+
+        const double CreatedPerSecond = ClassStats.NumCreated / TrackedSeconds;
+        const double AllocatedKBPerSecond = CreatedPerSecond * ClassStats.InstanceSize / 1024.0;
+        const bool bHasLifetime = ClassStats.NumSampledCollected > 0;
+        const double AverageLifetime = bHasLifetime ? ClassStats.SampledLifetimeSum / ClassStats.NumSampledCollected : 0.0;
+
+        // Little's law: average amount of objects alive at the same time, each of them is visited by every GC
+        const double AverageAlive = CreatedPerSecond * AverageLifetime;
+
+        const TCHAR* Hint = TEXT("");
+        if (bHasLifetime && CreatedPerSecond >= 10.0 && AverageLifetime < 1.0)
+        {
+            Hint = TEXT("frequent and short lived, consider PerFrame or Prototype lifetime, or pooling");
+        }
+        else if (bHasLifetime && CreatedPerSecond >= 1.0 && AverageLifetime >= 10.0)
+        {
+            Hint = TEXT("long lived, consider SingleInstance or WeakSingleInstance");
+        }
+
+        Output.Logf(TEXT("%-48s %10llu %10.2f %12s s %10.1f %12.2f  %s"),
+            *ClassStats.ClassName,
+            ClassStats.NumCreated,
+            CreatedPerSecond,
+            bHasLifetime ? *FString::Printf(TEXT("%.2f"), AverageLifetime) : TEXT("n/a"),
+            AverageAlive,
+            AllocatedKBPerSecond,
+            Hint);
+    }
+}
+
+void UnrealDI_Impl::FTransientChurnTracker::Reset(const TArray<FString>& Args, FOutputDevice& Output)
+{
+    Stats.Empty();
+    Samples.Empty();
+    TrackingStartTime = 0.0;
+
+    Output.Logf(TEXT("Transient churn data was cleared"));
+}
@@ -0,0 +1,60 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class FOutputDevice;
+
+namespace UnrealDI_Impl
+{
+    /*
+     * Counts objects created for registrations that do not share instances (e.g. Transient) while UnrealDI.TransientChurnSampleRate is greater than zero.
+     * Every Nth created object is tracked with a weak pointer to estimate how long such objects live until they are collected.
+     * Use UnrealDI.ReportTransientChurn console command to list registrations ranked by creation rate
+     */
+    class FTransientChurnTracker
+    {
+    public:
+        static void Init();
+        static void Shutdown();
+
+        static bool IsEnabled() { return SampleRate > 0; }
+
+        /* Call only when IsEnabled() returns true */
+        static void OnCreated(UObject& Object);
+
+        /* Handlers of UnrealDI.ReportTransientChurn and UnrealDI.ResetTransientChurn console commands */
+        static void Report(const TArray<FString>& Args, FOutputDevice& Output);
+        static void Reset(const TArray<FString>& Args, FOutputDevice& Output);
+
+        /* Value of UnrealDI.TransientChurnSampleRate console variable */
+        static int32 SampleRate;
+
+    private:
+        struct FClassStats
+        {
+            FString ClassName;
+            int32 InstanceSize = 0;
+            uint64 NumCreated = 0;
+            int32 NumSampledCollected = 0;
+            double SampledLifetimeSum = 0.0;
+        };
+
+        struct FSample
+        {
+            TWeakObjectPtr<UObject> Object;
+            TWeakObjectPtr<UClass> Class;
+            double CreationTime = 0.0;
+        };
+
+        static void PostGarbageCollect();
+
+        static TMap<TWeakObjectPtr<UClass>, FClassStats> Stats;
+        static TArray<FSample> Samples;
+        static double TrackingStartTime;
+        static FDelegateHandle PostGarbageCollectHandle;
+    };
+}
@@ -0,0 +1,20 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/Impl/TypedInstanceCreator.h"
+#include "GameFramework/Actor.h"
+#include "Blueprint/UserWidget.h"
+
+UObject* UnrealDI_Impl::FTypedInstanceCreator::SpawnActorDeferred(UObject* Outer, UClass* ActorClass)
+{
+    return UDefaultInstanceFactory::SpawnActorDeferred(Outer, ActorClass);
+}
+
+UObject* UnrealDI_Impl::FTypedInstanceCreator::CreateUserWidget(UObject* Outer, UClass* WidgetClass)
+{
+    return UDefaultInstanceFactory::CreateUserWidget(Outer, WidgetClass);
+}
+
+void UnrealDI_Impl::FTypedInstanceCreator::FinishSpawning(UObject& Actor)
+{
+    UDefaultInstanceFactory::FinishSpawning(*CastChecked<AActor>(&Actor));
+}
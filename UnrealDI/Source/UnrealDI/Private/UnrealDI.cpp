@@ -2,6 +2,11 @@
 
 #include "Modules/ModuleManager.h"
 #include "DI/Impl/DependenciesRegistry.h"
+#include "DI/InitReadiness.h"
+#include "UnrealDILog.h"
+#include "TransientChurnTracker.h"
+
+DEFINE_LOG_CATEGORY(LogUnrealDI);
 
 class FUnrealDIModuleImpl : public IModuleInterface
 {
@@ -10,6 +15,8 @@ public:
     {
         FModuleManager::Get().OnModulesChanged().AddRaw(this, &FUnrealDIModuleImpl::RegisterDependencies);
         UnrealDI_Impl::FDependenciesRegistry::Init();
+        UnrealDI_Impl::FTransientChurnTracker::Init();
+        FInitReadiness::Init();
         UnrealDI_Impl::FDependenciesRegistry::ProcessPendingRegistrations();
     }
 
@@ -17,6 +24,8 @@ public:
     {
         FModuleManager::Get().OnModulesChanged().RemoveAll(this);
         UnrealDI_Impl::FDependenciesRegistry::Shutdown();
+        UnrealDI_Impl::FTransientChurnTracker::Shutdown();
+        FInitReadiness::Shutdown();
     }
 
 private:
@@ -5,6 +5,7 @@
 #include "DI/IResolver.h"
 #include "DI/ObjectsCollection.h"
 #include "DI/Factory.h"
+#include "DI/ObjectsMap.h"
 #include "DI/Impl/StaticClass.h"
 #include "DI/Impl/IsUInterface.h"
 #include "UObject/ScriptInterface.h"
@@ -69,6 +70,20 @@ struct TDependencyResolver
     }
 };
 
+/* TObjectsMap<FName, USomeClass> or TObjectsMap<FName, ISomeInterface> */
+template <typename T>
+struct TDependencyResolver
+<
+    TObjectsMap<FName, T>,
+    typename TEnableIf< TOr< TIsDerivedFrom< T, UObject >, UnrealDI_Impl::TIsUInterface< T > >::Value >::Type
+>
+{
+    static TObjectsMap<FName, T> Resolve(const IResolver& Resolver)
+    {
+        return Resolver.ResolveMap(UnrealDI_Impl::TStaticClass<T>::StaticClass());
+    }
+};
+
 /* TFactory<USomeClass> or TFactory<ISomeInterface> */
 template <typename T>
 struct TDependencyResolver
@@ -139,3 +154,29 @@ struct TDependencyResolver
         return {};
     }
 };
+
+/* TSharedRef<FSomeNativeService> */
+template <typename T>
+struct TDependencyResolver
+<
+    TSharedRef<T>
+>
+{
+    static TSharedRef<T> Resolve(const IResolver& Resolver)
+    {
+        return Resolver.ResolveNative<T>();
+    }
+};
+
+/* TSharedPtr<FSomeNativeService>. Will be nullptr if service is not registered */
+template <typename T>
+struct TDependencyResolver
+<
+    TSharedPtr<T>
+>
+{
+    static TSharedPtr<T> Resolve(const IResolver& Resolver)
+    {
+        return Resolver.TryResolveNative<T>();
+    }
+};
@@ -0,0 +1,22 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/Interface.h"
+#include "IDisposable.generated.h"
+
+UINTERFACE(MinimalApi)
+class UDisposable : public UInterface { GENERATED_BODY() };
+
+/*
+ * Implement this interface in shared services (e.g. SingleInstance) to release resources when container is shut down.
+ * See UObjectContainer::Shutdown
+ */
+class IDisposable
+{
+    GENERATED_BODY()
+
+public:
+    /* Called before container releases this object. Services created later are disposed first, so dependencies are still alive here */
+    virtual void Dispose() = 0;
+};
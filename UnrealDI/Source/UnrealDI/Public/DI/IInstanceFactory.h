@@ -3,6 +3,7 @@
 #pragma once
 
 #include "UObject/Interface.h"
+#include "Math/Transform.h"
 #include "IInstanceFactory.generated.h"
 
 UINTERFACE(MinimalApi)
@@ -31,4 +32,10 @@ public:
 
     /* Performs final initialization of created object. This method is called after InitDependencies are called on Object */
     virtual void FinalizeCreation(UObject* Object) const = 0;
+
+    /*
+     * Creates new actor of specified class placed at Transform. Used by UObjectContainer::ResolveActors, FinalizeCreation is still called after injection.
+     * Default implementation calls Create and moves created actor to Transform before it is injected and finalized
+     */
+    virtual UObject* CreateAt(UObject* Outer, UClass* EffectiveClass, const FTransform& Transform) const;
 };
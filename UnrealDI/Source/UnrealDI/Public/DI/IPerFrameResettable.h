@@ -0,0 +1,22 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/Interface.h"
+#include "IPerFrameResettable.generated.h"
+
+UINTERFACE(MinimalApi)
+class UPerFrameResettable : public UInterface { GENERATED_BODY() };
+
+/*
+ * Implement this interface in services registered with PerFrame() to reuse the same instance on every frame.
+ * Otherwise new instance is created on first resolve in each frame
+ */
+class IPerFrameResettable
+{
+    GENERATED_BODY()
+
+public:
+    /* Called on first resolve in a new frame. Must bring object to the same state as if it was just created and injected */
+    virtual void ResetForNewFrame() = 0;
+};
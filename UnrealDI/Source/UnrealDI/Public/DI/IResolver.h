@@ -3,6 +3,8 @@
 #pragma once
 
 #include "DI/Impl/StaticClass.h"
+#include "DI/Impl/NativeTypeKey.h"
+#include "Templates/SharedPointer.h"
 #include "UObject/Interface.h"
 #include "Templates/EnableIf.h"
 #include "IResolver.generated.h"
@@ -13,6 +15,9 @@ class TObjectsCollection;
 template <typename T>
 class TFactory;
 
+template <typename TKey, typename T>
+class TObjectsMap;
+
 class UClass;
 
 UINTERFACE()
@@ -110,6 +115,57 @@ public:
     }
 
 
+    /* Returns instance of given Type registered under Key. Asserts if no registration has that Key. By default calls TryResolveKeyed */
+    virtual UObject* ResolveKeyed(UClass* Type, FName Key) const;
+
+    /* Returns instance of given Type registered under Key */
+    template <typename T>
+    typename TEnableIf<TIsDerivedFrom<T, UObject>::Value, T*>::Type
+        ResolveKeyed(FName Key) const
+    {
+        return (T*)ResolveKeyed(UnrealDI_Impl::TStaticClass< T >::StaticClass(), Key);
+    }
+
+    /* Returns instance of given Interface registered under Key */
+    template <typename T>
+    typename TEnableIf<UnrealDI_Impl::TIsUInterface< T >::Value, TScriptInterface< T >>::Type
+        ResolveKeyed(FName Key) const
+    {
+        return ResolveKeyed(UnrealDI_Impl::TStaticClass< T >::StaticClass(), Key);
+    }
+
+
+    /* Returns instance of given Type registered under Key if there is such registration, otherwise returns nullptr. By default nothing is registered with keys */
+    virtual UObject* TryResolveKeyed(UClass* Type, FName Key) const;
+
+    /* Returns instance of given Type registered under Key if there is such registration, otherwise returns nullptr */
+    template <typename T>
+    typename TEnableIf<TIsDerivedFrom<T, UObject>::Value, T*>::Type
+        TryResolveKeyed(FName Key) const
+    {
+        return (T*)TryResolveKeyed(UnrealDI_Impl::TStaticClass< T >::StaticClass(), Key);
+    }
+
+    /* Returns instance of given Interface registered under Key if there is such registration, otherwise returns nullptr */
+    template <typename T>
+    typename TEnableIf<UnrealDI_Impl::TIsUInterface< T >::Value, TScriptInterface< T >>::Type
+        TryResolveKeyed(FName Key) const
+    {
+        return TryResolveKeyed(UnrealDI_Impl::TStaticClass< T >::StaticClass(), Key);
+    }
+
+
+    /* Returns map of all registrations of given Type made with .Keyed(Key). Objects are created on first access to their key. By default returns empty map */
+    virtual TObjectsMap<FName, UObject> ResolveMap(UClass* Type) const;
+
+    /* Returns map of all registrations of given Type made with .Keyed(Key). Objects are created on first access to their key */
+    template <typename T>
+    TObjectsMap<FName, T> ResolveMap() const
+    {
+        return TObjectsMap<FName, T>(ResolveMap(UnrealDI_Impl::TStaticClass< T >::StaticClass()));
+    }
+
+
     /* Returns true if given type is Registered and can be resolved */
     virtual bool IsRegistered(UClass* Type) const = 0;
 
@@ -119,4 +175,33 @@ public:
     {
         return IsRegistered(UnrealDI_Impl::TStaticClass<T>::StaticClass());
     }
+
+
+    /*
+     * Resolves native service registered with FObjectContainerBuilder::RegisterNative.
+     * OutInstance must point to TSharedPtr<T> of the type that TypeKey was made from. Returns false if type is not registered.
+     * Resolvers that do not support native services may keep default implementation
+     */
+    virtual bool TryResolveNative(const UnrealDI_Impl::FNativeTypeKey* TypeKey, void* OutInstance) const { return false; }
+
+    /* Returns native service of given Type. Asserts if Type is not registered */
+    template <typename T>
+    TSharedRef<T> ResolveNative() const
+    {
+        TSharedPtr<T> Result;
+        const bool bResolved = TryResolveNative(UnrealDI_Impl::TNativeTypeKey<T>::Get(), &Result);
+        checkf(bResolved, TEXT("Native type %s is not registered"), *UnrealDI_Impl::TNativeTypeKey<T>::Get()->Name);
+
+        return Result.ToSharedRef();
+    }
+
+    /* Returns native service of given Type if it is registered, otherwise returns nullptr */
+    template <typename T>
+    TSharedPtr<T> TryResolveNative() const
+    {
+        TSharedPtr<T> Result;
+        TryResolveNative(UnrealDI_Impl::TNativeTypeKey<T>::Get(), &Result);
+
+        return Result;
+    }
 };
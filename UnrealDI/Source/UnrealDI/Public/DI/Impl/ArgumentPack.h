@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "Tasks/Task.h"
+
 namespace UnrealDI_Impl
 {
     template <typename...>
@@ -21,4 +23,11 @@ namespace UnrealDI_Impl
     {
         return TArgumentPack<TArgs...>();
     }
-}
\ No newline at end of file
+
+    // asynchronous InitDependencies. see FInitReadiness
+    template <typename T, typename... TArgs>
+    TArgumentPack<TArgs...> GetFunctionArgumentPack(UE::Tasks::FTask (T::*)(TArgs...))
+    {
+        return TArgumentPack<TArgs...>();
+    }
+}
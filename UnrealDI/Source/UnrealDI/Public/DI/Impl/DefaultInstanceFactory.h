@@ -5,6 +5,9 @@
 #include "DI/IInstanceFactory.h"
 #include "DefaultInstanceFactory.generated.h"
 
+class AActor;
+class UUserWidget;
+
 UCLASS(HideDropDown)
 class UNREALDI_API UDefaultInstanceFactory : public UObject, public IInstanceFactory
 {
@@ -14,4 +17,17 @@ public:
     bool IsClassSupported(UClass* EffectiveClass) const override { return true; }
     UObject* Create(UObject* Outer, UClass* EffectiveClass) const override;
     void FinalizeCreation(UObject* Object) const override;
+    UObject* CreateAt(UObject* Outer, UClass* EffectiveClass, const FTransform& Transform) const override;
+
+    /* Spawns deferred actor in World of Outer. FinishSpawning must be called after it is injected */
+    static AActor* SpawnActorDeferred(UObject* Outer, UClass* ActorClass, const FTransform& Transform = FTransform::Identity);
+
+    /* Finishes spawning of actor created by SpawnActorDeferred. Transform must be the same as passed to SpawnActorDeferred */
+    static void FinishSpawning(AActor& Actor, const FTransform& Transform = FTransform::Identity);
+
+    /* Creates widget owned by World of Outer */
+    static UUserWidget* CreateUserWidget(UObject* Outer, UClass* WidgetClass);
+
+    /* Creates plain object, trying to keep its name stable */
+    static UObject* CreateObject(UObject* Outer, UClass* ObjectClass);
 };
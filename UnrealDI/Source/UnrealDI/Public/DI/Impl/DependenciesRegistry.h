@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Containers/Map.h"
+#include "Containers/ArrayView.h"
+#include "Templates/UniquePtr.h"
 #include "Delegates/IDelegateInstance.h"
 #include "UObject/WeakObjectPtr.h"
 #include "UObject/WeakObjectPtrTemplates.h"
@@ -11,6 +13,7 @@ class UObject;
 class UClass;
 class IResolver;
 class UFunction;
+class FProperty;
 
 namespace UnrealDI_Impl
 {
@@ -25,6 +28,10 @@ namespace UnrealDI_Impl
         template <typename T>
         static void ExposeDependencies();
 
+        /* Called by generated code for native classes with fields marked with meta=(Inject), because property metadata does not exist in cooked builds */
+        template <typename T>
+        static void ExposeInjectedProperties(std::initializer_list<const TCHAR*> PropertyNames);
+
         static void ProcessPendingRegistrations();
         static void ClearBlueprintInitFunctionsCache();
 
@@ -32,6 +39,36 @@ namespace UnrealDI_Impl
 
         static FName MakeInitDependenciesFunctionName(UClass* Class);
 
+        /*
+         * Names of default subobjects of a class that have dependencies to inject or own such subobjects, at any depth.
+         * Components are listed separately from other subobjects
+         */
+        struct FInjectableSubobjects
+        {
+            TArray<FName> Components;
+            TArray<FName> Others;
+
+            bool IsEmpty() const { return Components.Num() == 0 && Others.Num() == 0; }
+        };
+
+        /* UPROPERTY marked with meta=(Inject). Resolved object is written directly into the field at Offset */
+        struct FInjectedProperty
+        {
+            int32 Offset;
+            UClass* Type;
+            bool bInterface;
+        };
+
+        /* Returns fields of Class (including inherited ones) marked with meta=(Inject). Only fields of native classes listed by code generator are returned */
+        static TConstArrayView<FInjectedProperty> FindInjectedProperties(UClass* Class);
+
+        static bool IsInjectable(UClass* Class);
+        /* Returns default subobjects of Class that must be visited to inject all of them. Returned reference stays valid while Class is alive */
+        static const FInjectableSubobjects& FindInjectableSubobjects(UClass* Class);
+
+        /* Returns true if Class or any of its default subobjects, at any depth, has dependencies to inject */
+        static bool IsInjectableWithSubobjects(UClass* Class);
+
     private:
         using FClassGetter = UClass* (*)();
 
@@ -41,18 +78,35 @@ namespace UnrealDI_Impl
             FInitFunctionPtr InitFunction;
         };
 
+        struct FUnprocessedPropertiesEntry
+        {
+            FClassGetter ClassGetter;
+            TArray<const TCHAR*> PropertyNames;
+        };
+
         struct FCacheEntry
         {
             FInitFunctionPtr NativeInitFunction = nullptr;
             UFunction* BlueprintInitFunction = nullptr;
+            TArray<FInjectedProperty> InjectedProperties;
         };
 
         static TArray<FUnprocessedEntry>& GetUnprocessedEntries();
+        static TArray<FUnprocessedPropertiesEntry>& GetUnprocessedPropertiesEntries();
+        static FCacheEntry& FindOrAddCacheEntry(UClass* Class);
         static FCacheEntry* AddInitFunctionsToCache(UClass* Class);
+        static FInjectableSubobjects& AddInjectableSubobjectsToCache(UClass* Class);
+        static void AddInjectedProperty(FCacheEntry& Entry, UClass* Class, FProperty& Property);
+#if WITH_METADATA
+        static void CheckNotExposedInjectedProperties(UClass* Class);
+#endif
         static void PostGarbageCollect();
 
         static inline TMap<UClass*, FInitFunctionPtr> NativeInitFunctions;
+        static inline TMap<UClass*, TArray<FName>> NativeInjectedProperties;
         static inline TMap<TWeakObjectPtr<UClass>, FCacheEntry> CachedInitFunctions;
+        // entries are allocated separately, because injection of subobjects adds entries for their classes while outer entry is iterated
+        static inline TMap<TWeakObjectPtr<UClass>, TUniquePtr<FInjectableSubobjects>> CachedInjectableSubobjects;
         static inline FDelegateHandle PostGarbageCollectHandle;
     };
 }
@@ -68,3 +122,13 @@ void UnrealDI_Impl::FDependenciesRegistry::ExposeDependencies()
     Entry.ClassGetter = &T::StaticClass;
     Entry.InitFunction = &TInstanceInjector<T>::Invoke;
 }
+
+template <typename T>
+void UnrealDI_Impl::FDependenciesRegistry::ExposeInjectedProperties(std::initializer_list<const TCHAR*> PropertyNames)
+{
+    TArray<FUnprocessedPropertiesEntry>& UnprocessedEntries = GetUnprocessedPropertiesEntries();
+
+    FUnprocessedPropertiesEntry& Entry = UnprocessedEntries.Emplace_GetRef();
+    Entry.ClassGetter = &T::StaticClass;
+    Entry.PropertyNames = PropertyNames;
+}
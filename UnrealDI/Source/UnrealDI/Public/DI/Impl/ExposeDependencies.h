@@ -18,4 +18,16 @@ namespace UnrealDI_Impl
 
 #define EXPOSE_DEPENDENCIES_INTERNAL(Class) \
     UnrealDI_Impl::TExposeDependenciesHelper<Class> ANONYMOUS_VARIABLE(ExposeStruct_ ## Class);
+
+    template <typename T>
+    struct TExposeInjectedPropertiesHelper
+    {
+        TExposeInjectedPropertiesHelper(std::initializer_list<const TCHAR*> PropertyNames)
+        {
+            FDependenciesRegistry::ExposeInjectedProperties<T>(PropertyNames);
+        }
+    };
+
+#define EXPOSE_INJECTED_PROPERTIES_INTERNAL(Class, ...) \
+    UnrealDI_Impl::TExposeInjectedPropertiesHelper<Class> ANONYMOUS_VARIABLE(ExposePropertiesStruct_ ## Class)({ __VA_ARGS__ });
 }
@@ -4,6 +4,13 @@
 
 #include "DI/Impl/ArgumentPack.h"
 #include "DI/Impl/HasInitDependencies.h"
+#include "DI/InitReadiness.h"
+#include "Templates/Tuple.h"
+#include "Templates/UnrealTypeTraits.h"
+#include "Templates/IsPointer.h"
+#include "Templates/RemovePointer.h"
+#include "UObject/ObjectPtr.h"
+#include "UObject/ScriptInterface.h"
 
 class IResolver;
 
@@ -36,7 +43,7 @@ namespace UnrealDI_Impl
     template <typename T>
     struct TInitDependeciesNoArgsInvoker<T, typename TEnableIf< THasInitDependencies<T>::Value >::Type>
     {
-        static void Invoke(T* Self) { Self->InitDependencies(); }
+        static void Invoke(T* Self);
     };
 
     // specialization for classes that have no InitDependencies
@@ -45,6 +52,16 @@ namespace UnrealDI_Impl
     {
         static void Invoke(T* Self) { /* call nothing, class have no InitDependencies method */ }
     };
+
+    // adds pending initialization of resolved dependency to OutTasks. only dependencies that reference UObjects may be pending
+    template <typename T>
+    void AppendDependencyReadiness(TArray<UE::Tasks::FTask>& OutTasks, const T& Dependency);
+
+    template <typename T>
+    struct TIsScriptInterface : TIntegralConstant<bool, false> {};
+
+    template <typename T>
+    struct TIsScriptInterface<TScriptInterface<T>> : TIntegralConstant<bool, true> {};
 }
 
 #include "DI/Impl/DependencyResolverInvoker.h"
@@ -58,5 +75,73 @@ void UnrealDI_Impl::TInitDependenciesInvoker<T, UnrealDI_Impl::TArgumentPack<>>:
 template <typename T, typename... TArgs>
 void UnrealDI_Impl::TInitDependenciesInvoker<T, UnrealDI_Impl::TArgumentPack<TArgs...>>::Invoke(T* Self, const IResolver& Resolver)
 {
-    Self->InitDependencies(TDependencyResolverInvoker<TArgs>(Resolver)...);
+    constexpr bool bAsync = TIsSame<decltype(Self->InitDependencies(DeclVal<TArgs>()...)), UE::Tasks::FTask>::Value;
+    static_assert(!bAsync || TIsDerivedFrom<T, UObject>::Value, "Asynchronous InitDependencies is supported only in UObjects");
+
+    if constexpr (TIsDerivedFrom<T, UObject>::Value)
+    {
+        // keep resolved dependencies, so we can check their readiness after InitDependencies is called
+        TTuple<typename TDecay<TArgs>::Type...> Dependencies(TDependencyResolver< typename TDecay<TArgs>::Type >::Resolve(Resolver)...);
+
+        TArray<UE::Tasks::FTask> DependencyTasks;
+        Dependencies.ApplyAfter([&DependencyTasks](const auto&... Dependency)
+        {
+            (AppendDependencyReadiness(DependencyTasks, Dependency), ...);
+        });
+
+        // default task is completed, so synchronous InitDependencies is waited for by its dependencies only
+        UE::Tasks::FTask InitTask;
+        if constexpr (bAsync)
+        {
+            InitTask = Dependencies.ApplyAfter([Self](auto&... Dependency)
+            {
+                return Self->InitDependencies(static_cast<TArgs&&>(Dependency)...);
+            });
+        }
+        else
+        {
+            Dependencies.ApplyAfter([Self](auto&... Dependency)
+            {
+                Self->InitDependencies(static_cast<TArgs&&>(Dependency)...);
+            });
+        }
+
+        FInitReadiness::Track(*Self, InitTask, DependencyTasks);
+    }
+    else
+    {
+        Self->InitDependencies(TDependencyResolverInvoker<TArgs>(Resolver)...);
+    }
+}
+
+template <typename T>
+void UnrealDI_Impl::TInitDependeciesNoArgsInvoker<T, typename TEnableIf< UnrealDI_Impl::THasInitDependencies<T>::Value >::Type>::Invoke(T* Self)
+{
+    if constexpr (TIsSame<decltype(Self->InitDependencies()), UE::Tasks::FTask>::Value)
+    {
+        static_assert(TIsDerivedFrom<T, UObject>::Value, "Asynchronous InitDependencies is supported only in UObjects");
+
+        FInitReadiness::Track(*Self, Self->InitDependencies(), {});
+    }
+    else
+    {
+        Self->InitDependencies();
+    }
+}
+
+template <typename T>
+void UnrealDI_Impl::AppendDependencyReadiness(TArray<UE::Tasks::FTask>& OutTasks, const T& Dependency)
+{
+    if constexpr (TIsPointer<T>::Value && TIsDerivedFrom<typename TRemovePointer<T>::Type, UObject>::Value)
+    {
+        FInitReadiness::AppendPending(OutTasks, Dependency);
+    }
+    else if constexpr (TIsTObjectPtr_V<T>)
+    {
+        FInitReadiness::AppendPending(OutTasks, Dependency.Get());
+    }
+    else if constexpr (TIsScriptInterface<T>::value)
+    {
+        FInitReadiness::AppendPending(OutTasks, Dependency.GetObject());
+    }
 }
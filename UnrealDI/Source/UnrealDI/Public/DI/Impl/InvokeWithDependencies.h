@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "DI/Impl/ArgumentPack.h"
 #include "DI/Impl/DependencyResolverInvoker.h"
 
 namespace UnrealDI_Impl
@@ -17,7 +18,7 @@ namespace UnrealDI_Impl
         }
     };
 
-    /* Provides type of TFunctionWithDependenciesInvoker based on TFunction arguments */
+    /* Provides type of TFunctionWithDependenciesInvoker and argument pack based on TFunction arguments */
     template <typename TFunction>
     struct TFunctionWithDependenciesInvokerProvider : public TFunctionWithDependenciesInvokerProvider< decltype(&TFunction::operator()) >
     {
@@ -28,6 +29,14 @@ namespace UnrealDI_Impl
     struct TFunctionWithDependenciesInvokerProvider<TResult(TClass::*)(TArgs...) const>
     {
         using Invoker = TFunctionWithDependenciesInvoker<TArgs...>;
+        using Arguments = TArgumentPack<TArgs...>;
+    };
+
+    /* Specialization for non-const member function (mutable lambda) */
+    template <typename TClass, typename TResult, typename... TArgs>
+    struct TFunctionWithDependenciesInvokerProvider<TResult(TClass::*)(TArgs...)>
+        : public TFunctionWithDependenciesInvokerProvider<TResult(TClass::*)(TArgs...) const>
+    {
     };
 
 }
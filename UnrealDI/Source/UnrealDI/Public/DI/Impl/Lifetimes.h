@@ -3,6 +3,12 @@
 #pragma once
 
 #include "UObject/Object.h"
+#include "UObject/UObjectGlobals.h"
+#include "CoreGlobals.h"
+#include "HAL/PlatformTime.h"
+#include "DI/IPerFrameResettable.h"
+
+class UObjectContainer;
 
 namespace UnrealDI_Impl
 {
@@ -14,6 +20,64 @@ namespace UnrealDI_Impl
         virtual UObject* Get() = 0;
         virtual void Set(UObject* Object) = 0;
         virtual void AddReferencedObjects(FReferenceCollector& Collector) = 0;
+
+        /*
+         * Returns instance kept by this handler without side effects (e.g. KeepAliveSingleInstance does not renew its keep alive, factories create nothing).
+         * Container uses it for its own bookkeeping, Get is called only when instance is resolved
+         */
+        virtual UObject* Peek() { return Get(); }
+
+        /*
+         * Returns object that container copies new instances from (e.g. Prototype), or nullptr to create them with instance factory.
+         * Copies keep injected state of archetype and are injected again only if archetype received dependencies that are not shared
+         */
+        virtual UObject* GetArchetype() const { return nullptr; }
+
+        /* Called for each registration that uses this handler, when it is added to Container */
+        virtual void OnAddedToContainer(const UObjectContainer& Container) {}
+
+        /* Called when container starts creating objects in another Outer. Handlers that cache objects found through old Outer must drop them */
+        virtual void OnOuterChanged() {}
+
+        /*
+         * Releases cached instance that container can recreate on next resolve. Returns released instance, if any.
+         * Called when memory is low, must not release instances that can't be recreated (e.g. SingleInstance)
+         */
+        virtual UObject* Trim() { return nullptr; }
+
+        /*
+         * Drops instance kept by this handler, so next resolve creates a new one. Used when registration is replaced at runtime.
+         * Returns false if handler does not create instances itself (e.g. Instance or factory registrations)
+         */
+        virtual bool Release() { return false; }
+
+        /* Returns true if all resolves of this registration share single instance */
+        virtual bool IsShared() const { return false; }
+
+        /* Returns name of this lifetime for diagnostic messages */
+        virtual const TCHAR* GetName() const { return TEXT("Custom"); }
+
+        /*
+         * Returns false if handler never keeps instances passed to Set. Such handlers have nothing to release when their dependencies change,
+         * so dependencies resolved while their instance is created are recorded for the closest handler up the resolve chain that keeps its instance
+         */
+        virtual bool KeepsInstance() const { return true; }
+
+        /* Remembers that instance of Dependent received instance of this registration when it was created */
+        void AddDependent(const TSharedRef<FLifetimeHandler>& Dependent)
+        {
+            // handler at the same address may be a new one, so weak pointer is always replaced
+            Dependents.FindOrAdd(&Dependent.Get()) = Dependent;
+        }
+
+        /* Handlers of instances that depend on this registration. Filled while instances are created */
+        TMap<const FLifetimeHandler*, TWeakPtr<FLifetimeHandler>> Dependents;
+
+        /* Sequence number of the last creation of shared instance by container. Older entries of container's creation order are stale */
+        uint64 CreationSequence = 0;
+
+        /* Whether instance created by container received dependency that is not shared (e.g. Transient or PerFrame). Filled while instance is created */
+        bool bReceivedUnsharedDependencies = false;
     };
 
     class FLifetimeHandler_Transient : public FLifetimeHandler
@@ -22,6 +86,9 @@ namespace UnrealDI_Impl
         UObject* Get() override { return nullptr; }
         void Set(UObject* Object) override {}
         void AddReferencedObjects(FReferenceCollector& Collector) override {}
+        bool Release() override { return true; }
+        bool KeepsInstance() const override { return false; }
+        const TCHAR* GetName() const override { return TEXT("Transient"); }
 
         static TSharedRef<FLifetimeHandler> Make() { return MakeShared<FLifetimeHandler_Transient>(); }
     };
@@ -39,6 +106,8 @@ namespace UnrealDI_Impl
         UObject* Get() override { return Factory(); }
         void Set(UObject* Object) override {}
         void AddReferencedObjects(FReferenceCollector& Collector) override {}
+        UObject* Peek() override { return nullptr; }
+        const TCHAR* GetName() const override { return TEXT("StaticFactory"); }
 
     private:
         FunctionPtr Factory;
@@ -55,6 +124,8 @@ namespace UnrealDI_Impl
         UObject* Get() override { return Factory(); }
         void Set(UObject* Object) override {}
         void AddReferencedObjects(FReferenceCollector& Collector) override {}
+        UObject* Peek() override { return nullptr; }
+        const TCHAR* GetName() const override { return TEXT("CustomFactory"); }
 
     private:
         TFunction<UObject* ()> Factory;
@@ -75,6 +146,9 @@ namespace UnrealDI_Impl
             Collector.AddReferencedObject(Instance);
         }
 
+        bool IsShared() const override { return true; }
+        const TCHAR* GetName() const override { return TEXT("Instance"); }
+
     private:
         TObjectPtr<UObject> Instance;
     };
@@ -89,6 +163,15 @@ namespace UnrealDI_Impl
             Collector.AddReferencedObject(Instance);
         }
 
+        bool Release() override
+        {
+            Instance = nullptr;
+            return true;
+        }
+
+        bool IsShared() const override { return true; }
+        const TCHAR* GetName() const override { return TEXT("SingleInstance"); }
+
         static TSharedRef<FLifetimeHandler> Make() { return MakeShared<FLifetimeHandler_SingleInstance>(); }
 
     private:
@@ -102,9 +185,191 @@ namespace UnrealDI_Impl
         void Set(UObject* Object) override { Instance = Object; }
         void AddReferencedObjects(FReferenceCollector& Collector) override {}
 
+        bool Release() override
+        {
+            Instance = nullptr;
+            return true;
+        }
+
+        bool IsShared() const override { return true; }
+        const TCHAR* GetName() const override { return TEXT("WeakSingleInstance"); }
+
         static TSharedRef<FLifetimeHandler> Make() { return MakeShared<FLifetimeHandler_WeakSingleInstance>(); }
 
     private:
         TWeakObjectPtr<UObject> Instance = nullptr;
     };
+
+    class FLifetimeHandler_KeepAliveSingleInstance : public FLifetimeHandler
+    {
+    public:
+        FLifetimeHandler_KeepAliveSingleInstance(double KeepAliveSeconds, int32 KeepAliveGCCycles)
+            : KeepAliveSeconds(KeepAliveSeconds)
+            , KeepAliveGCCycles(KeepAliveGCCycles)
+        {
+        }
+
+        ~FLifetimeHandler_KeepAliveSingleInstance()
+        {
+            FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+        }
+
+        UObject* Get() override
+        {
+            UObject* Object = Instance.Get();
+            if (Object != nullptr)
+            {
+                KeepAlive(Object);
+            }
+
+            return Object;
+        }
+
+        UObject* Peek() override { return Instance.Get(); }
+
+        void Set(UObject* Object) override
+        {
+            Instance = Object;
+            KeepAlive(Object);
+        }
+
+        void AddReferencedObjects(FReferenceCollector& Collector) override
+        {
+            // any reference collector may call this (e.g. reference viewer), so it must not change state
+            if (StrongInstance != nullptr && !IsExpired())
+            {
+                Collector.AddReferencedObject(StrongInstance);
+            }
+        }
+
+        void OnAddedToContainer(const UObjectContainer& Container) override
+        {
+            // called on game thread for each registered interface, subscribe only once
+            if (!PostGarbageCollectHandle.IsValid())
+            {
+                PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FLifetimeHandler_KeepAliveSingleInstance::OnPostGarbageCollect);
+            }
+        }
+
+        UObject* Trim() override
+        {
+            UObject* Released = StrongInstance;
+            StrongInstance = nullptr;
+            return Released;
+        }
+
+        bool Release() override
+        {
+            Instance = nullptr;
+            StrongInstance = nullptr;
+            return true;
+        }
+
+        bool IsShared() const override { return true; }
+        const TCHAR* GetName() const override { return TEXT("KeepAliveSingleInstance"); }
+
+        static TSharedRef<FLifetimeHandler> Make(double KeepAliveSeconds, int32 KeepAliveGCCycles)
+        {
+            return MakeShared<FLifetimeHandler_KeepAliveSingleInstance>(KeepAliveSeconds, KeepAliveGCCycles);
+        }
+
+    private:
+        void KeepAlive(UObject* Object)
+        {
+            StrongInstance = Object;
+            LastResolveTime = FPlatformTime::Seconds();
+            GCCyclesSinceResolve = 0;
+        }
+
+        bool IsExpired() const
+        {
+            const bool bTimeExpired = KeepAliveSeconds > 0.0 && FPlatformTime::Seconds() - LastResolveTime > KeepAliveSeconds;
+            const bool bCyclesExpired = KeepAliveGCCycles > 0 && GCCyclesSinceResolve >= KeepAliveGCCycles;
+
+            return bTimeExpired || bCyclesExpired;
+        }
+
+        void OnPostGarbageCollect()
+        {
+            if (StrongInstance == nullptr)
+            {
+                return;
+            }
+
+            ++GCCyclesSinceResolve;
+
+            if (IsExpired())
+            {
+                // from now on instance lives only while someone else references it, same as WeakSingleInstance
+                StrongInstance = nullptr;
+            }
+        }
+
+        TWeakObjectPtr<UObject> Instance = nullptr;
+        TObjectPtr<UObject> StrongInstance = nullptr;
+
+        double KeepAliveSeconds;
+        int32 KeepAliveGCCycles;
+
+        double LastResolveTime = 0.0;
+        int32 GCCyclesSinceResolve = 0;
+        FDelegateHandle PostGarbageCollectHandle;
+    };
+
+    class FLifetimeHandler_PerFrame : public FLifetimeHandler
+    {
+    public:
+        UObject* Get() override
+        {
+            if (Instance == nullptr || Frame == GFrameCounter)
+            {
+                return Instance;
+            }
+
+            Frame = GFrameCounter;
+
+            if (IPerFrameResettable* Resettable = Cast<IPerFrameResettable>(Instance))
+            {
+                Resettable->ResetForNewFrame();
+                return Instance;
+            }
+
+            Instance = nullptr;
+            return nullptr;
+        }
+
+        UObject* Peek() override { return Instance; }
+
+        void Set(UObject* Object) override
+        {
+            Instance = Object;
+            Frame = GFrameCounter;
+        }
+
+        void AddReferencedObjects(FReferenceCollector& Collector) override
+        {
+            Collector.AddReferencedObject(Instance);
+        }
+
+        UObject* Trim() override
+        {
+            UObject* Released = Instance;
+            Instance = nullptr;
+            return Released;
+        }
+
+        bool Release() override
+        {
+            Trim();
+            return true;
+        }
+
+        const TCHAR* GetName() const override { return TEXT("PerFrame"); }
+
+        static TSharedRef<FLifetimeHandler> Make() { return MakeShared<FLifetimeHandler_PerFrame>(); }
+
+    private:
+        TObjectPtr<UObject> Instance = nullptr;
+        uint64 Frame = 0;
+    };
 }
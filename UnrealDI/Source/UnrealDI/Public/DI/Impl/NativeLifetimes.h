@@ -0,0 +1,84 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Templates/SharedPointer.h"
+#include "DI/Impl/InitDependenciesInvoker.h"
+#include "DI/Impl/InitMethodTypologyDeducer.h"
+
+class IResolver;
+
+namespace UnrealDI_Impl
+{
+    /*
+     * Lifetime of a native (non UObject) service.
+     * Unlike FLifetimeHandler it also creates instances, because native services never go through IInstanceFactory
+     */
+    class FNativeLifetimeHandler
+    {
+    public:
+        virtual ~FNativeLifetimeHandler() = default;
+
+        /* Writes instance into OutInstance, which points to TSharedPtr of registered interface type */
+        virtual void Resolve(const IResolver& Resolver, void* OutInstance) = 0;
+
+        /* Drops instance kept by this handler, so next resolve creates a new one */
+        virtual void Release() {}
+
+        /* Returns name of this lifetime for diagnostic messages */
+        virtual const TCHAR* GetName() const = 0;
+    };
+
+    /* Creates native service and calls its InitDependencies */
+    template <typename TImpl>
+    struct TNativeInstanceCreator
+    {
+        static TSharedRef<TImpl> Create(const IResolver& Resolver)
+        {
+            TSharedRef<TImpl> Instance = MakeShared<TImpl>();
+
+            using Invoker = TInitDependenciesInvoker<TImpl, TInitMethodTypologyDeducer<TImpl>>;
+            Invoker::Invoke(&Instance.Get(), Resolver);
+
+            return Instance;
+        }
+    };
+
+    template <typename TInterface, typename TImpl>
+    class TNativeLifetimeHandler_Transient : public FNativeLifetimeHandler
+    {
+    public:
+        void Resolve(const IResolver& Resolver, void* OutInstance) override
+        {
+            *static_cast<TSharedPtr<TInterface>*>(OutInstance) = TNativeInstanceCreator<TImpl>::Create(Resolver);
+        }
+
+        const TCHAR* GetName() const override { return TEXT("NativeTransient"); }
+
+        static TSharedRef<FNativeLifetimeHandler> Make() { return MakeShared<TNativeLifetimeHandler_Transient>(); }
+    };
+
+    template <typename TInterface, typename TImpl>
+    class TNativeLifetimeHandler_SingleInstance : public FNativeLifetimeHandler
+    {
+    public:
+        void Resolve(const IResolver& Resolver, void* OutInstance) override
+        {
+            if (!Instance.IsValid())
+            {
+                Instance = TNativeInstanceCreator<TImpl>::Create(Resolver);
+            }
+
+            *static_cast<TSharedPtr<TInterface>*>(OutInstance) = Instance;
+        }
+
+        void Release() override { Instance.Reset(); }
+
+        const TCHAR* GetName() const override { return TEXT("NativeSingleInstance"); }
+
+        static TSharedRef<FNativeLifetimeHandler> Make() { return MakeShared<TNativeLifetimeHandler_SingleInstance>(); }
+
+    private:
+        TSharedPtr<TInterface> Instance;
+    };
+}
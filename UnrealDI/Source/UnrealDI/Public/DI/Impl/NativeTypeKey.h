@@ -0,0 +1,47 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/UnrealString.h"
+
+namespace UnrealDI_Impl
+{
+    /*
+     * Identity of a native type. Exactly one exists for each type in the whole process, so its address is used as registration key
+     */
+    struct UNREALDI_API FNativeTypeKey
+    {
+        /* Compiler generated signature the key was made from, used in diagnostic messages */
+        FString Name;
+
+        /*
+         * Returns key for given compiler generated signature. Signatures are compared case-sensitively.
+         * Each module has its own copy of TNativeTypeKey<T> statics, so they are all resolved to a single key here
+         */
+        static const FNativeTypeKey* FindOrAdd(const ANSICHAR* Signature);
+    };
+
+    /*
+     * Provides unique key for any C++ type without relying on RTTI.
+     * Key is looked up once per module by compiler generated function signature, later calls only read a static
+     */
+    template <typename T>
+    struct TNativeTypeKey
+    {
+        static const FNativeTypeKey* Get()
+        {
+            static const FNativeTypeKey* Key = FNativeTypeKey::FindOrAdd(GetSignature());
+            return Key;
+        }
+
+    private:
+        static const ANSICHAR* GetSignature()
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+    };
+}
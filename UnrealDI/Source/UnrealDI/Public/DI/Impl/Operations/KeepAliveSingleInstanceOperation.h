@@ -0,0 +1,35 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Templates/UnrealTypeTraits.h"
+#include "DI/Impl/Lifetimes.h"
+
+namespace UnrealDI_Impl
+{
+namespace RegistrationOperations
+{
+    template<typename TConfigurator>
+    class TKeepAliveSingleInstanceOperation
+    {
+    public:
+        /*
+         * Only one instance will be created. Container keeps a strong reference to it for KeepAliveSeconds after last resolve
+         * or for KeepAliveGCCycles garbage collections, whichever comes first (zero disables the limit).
+         * After that it behaves as WeakSingleInstance. Strong reference is also released by UObjectContainer::TrimMemory
+         */
+        TConfigurator& KeepAliveSingleInstance(double KeepAliveSeconds, int32 KeepAliveGCCycles = 0)
+        {
+            checkf(KeepAliveSeconds > 0.0 || KeepAliveGCCycles > 0, TEXT("At least one of keep alive limits must be set"));
+
+            TConfigurator& This = StaticCast<TConfigurator&>(*this);
+            This.LifetimeHandlerFactory = [KeepAliveSeconds, KeepAliveGCCycles]()
+            {
+                return FLifetimeHandler_KeepAliveSingleInstance::Make(KeepAliveSeconds, KeepAliveGCCycles);
+            };
+
+            return This;
+        }
+    };
+}
+}
@@ -0,0 +1,30 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/NameTypes.h"
+
+namespace UnrealDI_Impl
+{
+namespace RegistrationOperations
+{
+    template<typename TConfigurator>
+    class TKeyedOperation
+    {
+    public:
+        /*
+         * Registers type under given Key. Keyed registrations are resolved only by key,
+         * using IResolver::ResolveKeyed or TObjectsMap, and never by plain Resolve or ResolveAll
+         */
+        TConfigurator& Keyed(FName Key)
+        {
+            checkf(!Key.IsNone(), TEXT("Registration key must not be None"));
+
+            TConfigurator& This = StaticCast<TConfigurator&>(*this);
+            This.Key = Key;
+
+            return This;
+        }
+    };
+}
+}
@@ -0,0 +1,29 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Templates/UnrealTypeTraits.h"
+#include "DI/Impl/Lifetimes.h"
+
+namespace UnrealDI_Impl
+{
+namespace RegistrationOperations
+{
+    template<typename TConfigurator>
+    class TPerFrameOperation
+    {
+    public:
+        /*
+         * All resolves within one engine frame will return the same instance.
+         * On next frame instance is reset and reused if it implements IPerFrameResettable, otherwise new instance is created
+         */
+        TConfigurator& PerFrame()
+        {
+            TConfigurator& This = StaticCast<TConfigurator&>(*this);
+            This.LifetimeHandlerFactory = &FLifetimeHandler_PerFrame::Make;
+
+            return This;
+        }
+    };
+}
+}
@@ -0,0 +1,31 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Templates/UnrealTypeTraits.h"
+#include "DI/Impl/PrototypeLifetime.h"
+
+namespace UnrealDI_Impl
+{
+namespace RegistrationOperations
+{
+    template<typename TConfigurator>
+    class TPrototypeOperation
+    {
+    public:
+        /*
+         * Each resolve returns new instance, cloned from a template made of first created instance.
+         * Clones receive state and shared dependencies through UPROPERTY values of the template, so use it only for types that keep all their state in UPROPERTY members.
+         * InitDependencies is called only once, unless template received dependencies that are not shared (e.g. Transient or PerFrame):
+         * then each clone is injected again, so it does not share them with the template. Actors and widgets are not supported
+         */
+        TConfigurator& Prototype()
+        {
+            TConfigurator& This = StaticCast<TConfigurator&>(*this);
+            This.LifetimeHandlerFactory = &FLifetimeHandler_Prototype::Make;
+
+            return This;
+        }
+    };
+}
+}
@@ -0,0 +1,190 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/DependencyResolver.h"
+#include "DI/Impl/ArgumentPack.h"
+#include "DI/Impl/InvokeWithDependencies.h"
+#include "Templates/Tuple.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UObjectContainer;
+
+namespace UnrealDI_Impl
+{
+    class FLifetimeHandler;
+
+    /* Container that prepared invocation. Asserts if invocation is called after container is destroyed or shut down */
+    class UNREALDI_API FPreparedResolver
+    {
+    public:
+        explicit FPreparedResolver(const UObjectContainer& InContainer);
+
+        const IResolver& Get() const;
+
+    private:
+        TWeakObjectPtr<const UObjectContainer> Container;
+    };
+
+    /*
+     * Single object argument of prepared invocation. Registration is looked up once.
+     * Instance of shared registration is then taken directly from its lifetime, other registrations are resolved on each call
+     */
+    class UNREALDI_API FPreparedObjectSlot
+    {
+    public:
+        FPreparedObjectSlot(const UObjectContainer& Container, UClass* InType);
+
+        UObject* Get(const FPreparedResolver& Resolver) const;
+
+    private:
+        UClass* Type;
+        TWeakPtr<FLifetimeHandler> SharedLifetime;
+    };
+
+    /* Argument that is resolved on each call, the same way as for InvokeWithDependencies */
+    template <typename T, typename TCondition = void>
+    struct TPreparedArgument
+    {
+        TPreparedArgument(const UObjectContainer& Container, const FPreparedResolver& Resolver)
+        {
+        }
+
+        T Get(const FPreparedResolver& Resolver) const
+        {
+            return TDependencyResolver<T>::Resolve(Resolver.Get());
+        }
+    };
+
+    /* USomeClass* */
+    template <typename T>
+    struct TPreparedArgument<T*, typename TEnableIf< TIsDerivedFrom< T, UObject >::Value >::Type>
+    {
+        TPreparedArgument(const UObjectContainer& Container, const FPreparedResolver& Resolver)
+            : Slot(Container, TStaticClass<T>::StaticClass())
+        {
+        }
+
+        T* Get(const FPreparedResolver& Resolver) const
+        {
+            return Cast<T>(Slot.Get(Resolver));
+        }
+
+        FPreparedObjectSlot Slot;
+    };
+
+    /* TObjectPtr<USomeClass> */
+    template <typename T>
+    struct TPreparedArgument<TObjectPtr<T>, typename TEnableIf< TIsDerivedFrom< T, UObject >::Value >::Type>
+    {
+        TPreparedArgument(const UObjectContainer& Container, const FPreparedResolver& Resolver)
+            : Slot(Container, TStaticClass<T>::StaticClass())
+        {
+        }
+
+        TObjectPtr<T> Get(const FPreparedResolver& Resolver) const
+        {
+            return Cast<T>(Slot.Get(Resolver));
+        }
+
+        FPreparedObjectSlot Slot;
+    };
+
+    /* TScriptInterface<ISomeInterface> */
+    template <typename T>
+    struct TPreparedArgument<TScriptInterface<T>, typename TEnableIf< TIsUInterface< T >::Value >::Type>
+    {
+        TPreparedArgument(const UObjectContainer& Container, const FPreparedResolver& Resolver)
+            : Slot(Container, TStaticClass<T>::StaticClass())
+        {
+        }
+
+        TScriptInterface<T> Get(const FPreparedResolver& Resolver) const
+        {
+            return Slot.Get(Resolver);
+        }
+
+        FPreparedObjectSlot Slot;
+    };
+
+    /* TFactory<USomeClass> or TFactory<ISomeInterface>. Factory itself does not depend on registration state, so it is resolved once */
+    template <typename T>
+    struct TPreparedArgument<TFactory<T>, typename TEnableIf< TOr< TIsDerivedFrom< T, UObject >, TIsUInterface< T > >::Value >::Type>
+    {
+        TPreparedArgument(const UObjectContainer& Container, const FPreparedResolver& Resolver)
+            : Factory(TDependencyResolver< TFactory<T> >::Resolve(Resolver.Get()))
+        {
+        }
+
+        TFactory<T> Get(const FPreparedResolver& Resolver) const
+        {
+            return Factory;
+        }
+
+        TFactory<T> Factory;
+    };
+
+    /* Removes runtime arguments from the beginning of function arguments. What is left is injected */
+    template <typename TRuntimeArgs, typename TFunctionArgs>
+    struct TInjectedArgumentPack;
+
+    template <typename... TFunctionArgs>
+    struct TInjectedArgumentPack<TArgumentPack<>, TArgumentPack<TFunctionArgs...>>
+    {
+        using Type = TArgumentPack<TFunctionArgs...>;
+    };
+
+    template <typename TRuntimeArg, typename... TRuntimeArgs, typename TFunctionArg, typename... TFunctionArgs>
+    struct TInjectedArgumentPack<TArgumentPack<TRuntimeArg, TRuntimeArgs...>, TArgumentPack<TFunctionArg, TFunctionArgs...>>
+        : public TInjectedArgumentPack<TArgumentPack<TRuntimeArgs...>, TArgumentPack<TFunctionArgs...>>
+    {
+    };
+
+    template <typename TFunction, typename TRuntimeArgs, typename TInjectedArgs>
+    class TPreparedInvocation;
+
+    /*
+     * Function bound to prepared arguments. Call it with runtime arguments, injected arguments are appended after them.
+     * Must not be called after container that prepared it is destroyed
+     */
+    template <typename TFunction, typename... TRuntimeArgs, typename... TInjectedArgs>
+    class TPreparedInvocation<TFunction, TArgumentPack<TRuntimeArgs...>, TArgumentPack<TInjectedArgs...>>
+    {
+    public:
+        template <typename TFunctionArg>
+        TPreparedInvocation(const UObjectContainer& Container, TFunctionArg&& InFunction)
+            : Function(Forward<TFunctionArg>(InFunction))
+            , Resolver(Container)
+            , Arguments(TPreparedArgument< typename TDecay<TInjectedArgs>::Type >(Container, Resolver)...)
+        {
+        }
+
+        decltype(auto) operator()(TRuntimeArgs... RuntimeArgs) const
+        {
+            return Invoke(TMakeIntegerSequence<uint32, sizeof...(TInjectedArgs)>(), Forward<TRuntimeArgs>(RuntimeArgs)...);
+        }
+
+    private:
+        template <uint32... Indices>
+        decltype(auto) Invoke(TIntegerSequence<uint32, Indices...>, TRuntimeArgs... RuntimeArgs) const
+        {
+            return Function(Forward<TRuntimeArgs>(RuntimeArgs)..., Arguments.template Get<Indices>().Get(Resolver)...);
+        }
+
+        // mutable lambdas may be prepared too, calling them does not change which dependencies are injected
+        mutable TFunction Function;
+        FPreparedResolver Resolver;
+        TTuple< TPreparedArgument< typename TDecay<TInjectedArgs>::Type >... > Arguments;
+    };
+
+    /* Provides type of TPreparedInvocation for TFunction, which receives TRuntimeArgs first */
+    template <typename TFunction, typename... TRuntimeArgs>
+    struct TPreparedInvocationProvider
+    {
+        using Type = TPreparedInvocation<
+            TFunction,
+            TArgumentPack<TRuntimeArgs...>,
+            typename TInjectedArgumentPack< TArgumentPack<TRuntimeArgs...>, typename TFunctionWithDependenciesInvokerProvider<TFunction>::Arguments >::Type
+        >;
+    };
+}
@@ -0,0 +1,37 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/Impl/Lifetimes.h"
+
+namespace UnrealDI_Impl
+{
+    /*
+     * First instance is created and injected as usual, and its copy is kept as a template.
+     * Container creates later instances with that template as archetype, so their constructor is still called and all UPROPERTY values are copied from template.
+     * InitDependencies is not called for them, unless template received dependencies that are not shared (e.g. Transient or PerFrame),
+     * in which case each instance is injected again to get its own dependencies
+     */
+    class UNREALDI_API FLifetimeHandler_Prototype : public FLifetimeHandler
+    {
+    public:
+        UObject* Get() override { return nullptr; }
+        void Set(UObject* Object) override;
+        void AddReferencedObjects(FReferenceCollector& Collector) override;
+        UObject* GetArchetype() const override { return Template; }
+
+        UObject* Trim() override;
+        bool Release() override
+        {
+            Trim();
+            return true;
+        }
+
+        const TCHAR* GetName() const override { return TEXT("Prototype"); }
+
+        static TSharedRef<FLifetimeHandler> Make() { return MakeShared<FLifetimeHandler_Prototype>(); }
+
+    private:
+        TObjectPtr<UObject> Template = nullptr;
+    };
+}
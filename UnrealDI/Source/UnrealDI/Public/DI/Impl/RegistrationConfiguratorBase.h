@@ -4,6 +4,7 @@
 
 #include "Containers/Array.h"
 #include "Templates/SharedPointer.h"
+#include "UObject/NameTypes.h"
 #include "UObject/SoftObjectPtr.h"
 
 class UClass;
@@ -13,12 +14,13 @@ class FObjectContainerBuilder;
 namespace UnrealDI_Impl
 {
     class FLifetimeHandler;
+    struct FTypedInstanceCreator;
 
     class FRegistrationConfiguratorBase
     {
     public:
         FRegistrationConfiguratorBase(UClass* InType)
-            : ImplClass(InType), EffectiveClassPtr(InType)
+            : ImplClass(InType), ImplClassPtr(InType), EffectiveClassPtr(ImplClassPtr)
         {
         }
 
@@ -29,8 +31,16 @@ namespace UnrealDI_Impl
         friend class ::FObjectContainerBuilder;
 
         UClass* ImplClass;
+
+        // soft path of ImplClass is found on registration, because compile phase of the builder may run outside of game thread
+        TSoftClassPtr<UObject> ImplClassPtr;
+
         TArray<UClass*> InterfaceTypes;
         TSoftClassPtr<UObject> EffectiveClassPtr;
+        FName Key;
+
+        // set for native types, used when registered class itself is created by default instance factory
+        const FTypedInstanceCreator* TypedCreator = nullptr;
         bool bAutoCreate = false;
     };
 }
@@ -6,6 +6,7 @@
 #include "DI/Impl/Operations/AsOperation.h"
 #include "DI/Impl/Operations/AsSelfOperation.h"
 #include "DI/Impl/Operations/ByInterfacesOperation.h"
+#include "DI/Impl/Operations/KeyedOperation.h"
 #include "DI/Impl/Operations/SingleInstanceOperation.h"
 #include "DI/Impl/Operations/WeakSingleInstanceOperation.h"
 #include "DI/Impl/Lifetimes.h"
@@ -22,6 +23,7 @@ namespace UnrealDI_Impl
         , public RegistrationOperations::TAsOperation< ThisType >
         , public RegistrationOperations::TAsSelfOperation< ThisType >
         , public RegistrationOperations::TByInterfacesOperation< ThisType >
+        , public RegistrationOperations::TKeyedOperation< ThisType >
         , public RegistrationOperations::TSingleInstanceOperation< ThisType >
         , public RegistrationOperations::TWeakSingleInstanceOperation< ThisType >
     {
@@ -46,6 +48,7 @@ namespace UnrealDI_Impl
         friend class RegistrationOperations::TAsOperation< ThisType >;
         friend class RegistrationOperations::TAsSelfOperation< ThisType >;
         friend class RegistrationOperations::TByInterfacesOperation< ThisType >;
+        friend class RegistrationOperations::TKeyedOperation< ThisType >;
         friend class RegistrationOperations::TSingleInstanceOperation< ThisType >;
         friend class RegistrationOperations::TWeakSingleInstanceOperation< ThisType >;
 
@@ -6,6 +6,7 @@
 #include "DI/Impl/Operations/AsOperation.h"
 #include "DI/Impl/Operations/AsSelfOperation.h"
 #include "DI/Impl/Operations/ByInterfacesOperation.h"
+#include "DI/Impl/Operations/KeyedOperation.h"
 #include "DI/Impl/Lifetimes.h"
 
 namespace UnrealDI_Impl
@@ -18,6 +19,7 @@ namespace UnrealDI_Impl
         , public RegistrationOperations::TAsOperation< ThisType >
         , public RegistrationOperations::TAsSelfOperation< ThisType >
         , public RegistrationOperations::TByInterfacesOperation< ThisType >
+        , public RegistrationOperations::TKeyedOperation< ThisType >
     {
     public:
         using ImplType = TObject;
@@ -40,6 +42,7 @@ namespace UnrealDI_Impl
         friend class RegistrationOperations::TAsOperation< ThisType >;
         friend class RegistrationOperations::TAsSelfOperation< ThisType >;
         friend class RegistrationOperations::TByInterfacesOperation< ThisType >;
+        friend class RegistrationOperations::TKeyedOperation< ThisType >;
 
         TObject* Instance;
     };
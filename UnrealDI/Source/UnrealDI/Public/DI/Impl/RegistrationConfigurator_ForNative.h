@@ -0,0 +1,55 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/Impl/NativeLifetimes.h"
+#include "DI/Impl/NativeTypeKey.h"
+#include "Templates/UnrealTypeTraits.h"
+
+class FObjectContainerBuilder;
+class UObject;
+
+namespace UnrealDI_Impl
+{
+    class FNativeRegistrationConfiguratorBase
+    {
+    public:
+        using FLifetimeHandlerFactory = TSharedRef<FNativeLifetimeHandler>(*)();
+
+        FNativeRegistrationConfiguratorBase(const FNativeTypeKey* InTypeKey, FLifetimeHandlerFactory InLifetimeHandlerFactory)
+            : TypeKey(InTypeKey), LifetimeHandlerFactory(InLifetimeHandlerFactory)
+        {
+        }
+
+        virtual ~FNativeRegistrationConfiguratorBase() = default;
+
+    protected:
+        friend class ::FObjectContainerBuilder;
+
+        const FNativeTypeKey* TypeKey;
+        FLifetimeHandlerFactory LifetimeHandlerFactory;
+    };
+
+    template<typename TInterface, typename TImpl>
+    class TRegistrationConfigurator_ForNative : public FNativeRegistrationConfiguratorBase
+    {
+    public:
+        static_assert(!TIsDerivedFrom<TImpl, UObject>::Value, "Native registrations are intended for plain C++ types. Use RegisterType for UObjects");
+        static_assert(TIsDerivedFrom<TImpl, TInterface>::Value, "Implementation type must be derived from Interface type");
+
+        TRegistrationConfigurator_ForNative(const TRegistrationConfigurator_ForNative&) = delete;
+        TRegistrationConfigurator_ForNative(TRegistrationConfigurator_ForNative&&) = default;
+
+        TRegistrationConfigurator_ForNative()
+            : FNativeRegistrationConfiguratorBase(TNativeTypeKey<TInterface>::Get(), &TNativeLifetimeHandler_Transient<TInterface, TImpl>::Make)
+        {
+        }
+
+        /* Only one instance will be created. Container will keep it until container itself is destroyed */
+        TRegistrationConfigurator_ForNative& SingleInstance()
+        {
+            LifetimeHandlerFactory = &TNativeLifetimeHandler_SingleInstance<TInterface, TImpl>::Make;
+            return *this;
+        }
+    };
+}
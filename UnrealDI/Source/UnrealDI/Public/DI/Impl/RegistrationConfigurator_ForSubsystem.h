@@ -0,0 +1,48 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/Impl/RegistrationConfiguratorBase.h"
+#include "DI/Impl/Operations/AsOperation.h"
+#include "DI/Impl/Operations/AsSelfOperation.h"
+#include "DI/Impl/Operations/ByInterfacesOperation.h"
+#include "DI/Impl/SubsystemLifetime.h"
+#include "Subsystems/Subsystem.h"
+
+namespace UnrealDI_Impl
+{
+#define ThisType TRegistrationConfigurator_ForSubsystem<TObject>
+
+    template<typename TObject>
+    class TRegistrationConfigurator_ForSubsystem
+        : public FRegistrationConfiguratorBase
+        , public RegistrationOperations::TAsOperation< ThisType >
+        , public RegistrationOperations::TAsSelfOperation< ThisType >
+        , public RegistrationOperations::TByInterfacesOperation< ThisType >
+    {
+    public:
+        static_assert(TIsDerivedFrom<TObject, USubsystem>::Value, "Only USubsystem derived classes may be registered as subsystems");
+
+        using ImplType = TObject;
+
+        TRegistrationConfigurator_ForSubsystem(const TRegistrationConfigurator_ForSubsystem&) = delete;
+        TRegistrationConfigurator_ForSubsystem(TRegistrationConfigurator_ForSubsystem&&) = default;
+
+        TRegistrationConfigurator_ForSubsystem()
+            : FRegistrationConfiguratorBase(TObject::StaticClass())
+        {
+        }
+
+        TSharedRef<FLifetimeHandler> CreateLifetimeHandler() const override
+        {
+            return MakeShared<UnrealDI_Impl::FLifetimeHandler_Subsystem>(TObject::StaticClass());
+        }
+
+    private:
+        friend class RegistrationOperations::TAsOperation< ThisType >;
+        friend class RegistrationOperations::TAsSelfOperation< ThisType >;
+        friend class RegistrationOperations::TByInterfacesOperation< ThisType >;
+    };
+
+#undef ThisType
+}
@@ -6,11 +6,17 @@
 #include "DI/Impl/Operations/AsOperation.h"
 #include "DI/Impl/Operations/AsSelfOperation.h"
 #include "DI/Impl/Operations/ByInterfacesOperation.h"
+#include "DI/Impl/Operations/KeyedOperation.h"
 #include "DI/Impl/Operations/SingleInstanceOperation.h"
 #include "DI/Impl/Operations/WeakSingleInstanceOperation.h"
+#include "DI/Impl/Operations/KeepAliveSingleInstanceOperation.h"
+#include "DI/Impl/Operations/PerFrameOperation.h"
+#include "DI/Impl/Operations/PrototypeOperation.h"
 #include "DI/Impl/Operations/FromBlueprintOperation.h"
+#include "DI/Impl/TypedInstanceCreator.h"
 #include "UObject/Interface.h"
 #include "Templates/UnrealTypeTraits.h"
+#include "Templates/Function.h"
 
 namespace UnrealDI_Impl
 {
@@ -22,8 +28,12 @@ namespace UnrealDI_Impl
         , public RegistrationOperations::TAsOperation< ThisType >
         , public RegistrationOperations::TAsSelfOperation< ThisType >
         , public RegistrationOperations::TByInterfacesOperation< ThisType >
+        , public RegistrationOperations::TKeyedOperation< ThisType >
         , public RegistrationOperations::TSingleInstanceOperation< ThisType >
         , public RegistrationOperations::TWeakSingleInstanceOperation< ThisType >
+        , public RegistrationOperations::TKeepAliveSingleInstanceOperation< ThisType >
+        , public RegistrationOperations::TPerFrameOperation< ThisType >
+        , public RegistrationOperations::TPrototypeOperation< ThisType >
         , public RegistrationOperations::TFromBlueprintOperation< ThisType, TObject >
     {
     public:
@@ -31,7 +41,7 @@ namespace UnrealDI_Impl
         static_assert(!TIsDerivedFrom<TObject, UInterface>::Value, "You are trying to register UInterface derived class. This is probably a typo");
 
         using ImplType = TObject;
-        using FLifetimeHandlerFactory = TSharedRef<FLifetimeHandler>(*)();
+        using FLifetimeHandlerFactory = TFunction<TSharedRef<FLifetimeHandler>()>;
 
         TRegistrationConfigurator_ForType(const TRegistrationConfigurator_ForType&) = delete;
         TRegistrationConfigurator_ForType(TRegistrationConfigurator_ForType&&) = default;
@@ -40,6 +50,7 @@ namespace UnrealDI_Impl
             : FRegistrationConfiguratorBase(TObject::StaticClass())
         {
             LifetimeHandlerFactory = &FLifetimeHandler_Transient::Make;
+            TypedCreator = &TTypedInstanceCreator<TObject>::Value;
         }
 
         TSharedRef<FLifetimeHandler> CreateLifetimeHandler() const override
@@ -51,8 +62,12 @@ namespace UnrealDI_Impl
         friend class RegistrationOperations::TAsOperation< ThisType >;
         friend class RegistrationOperations::TAsSelfOperation< ThisType >;
         friend class RegistrationOperations::TByInterfacesOperation< ThisType >;
+        friend class RegistrationOperations::TKeyedOperation< ThisType >;
         friend class RegistrationOperations::TSingleInstanceOperation< ThisType >;
         friend class RegistrationOperations::TWeakSingleInstanceOperation< ThisType >;
+        friend class RegistrationOperations::TKeepAliveSingleInstanceOperation< ThisType >;
+        friend class RegistrationOperations::TPerFrameOperation< ThisType >;
+        friend class RegistrationOperations::TPrototypeOperation< ThisType >;
         friend class RegistrationOperations::TFromBlueprintOperation< ThisType, TObject >;
 
         FLifetimeHandlerFactory LifetimeHandlerFactory;
@@ -0,0 +1,60 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/SoftObjectPtr.h"
+
+class UObject;
+class UClass;
+class IResolver;
+
+namespace UnrealDI_Impl
+{
+    class FLifetimeHandler;
+    class FNativeLifetimeHandler;
+    struct FNativeTypeKey;
+    struct FTypedInstanceCreator;
+
+    struct FResolver
+    {
+        UClass* Interface;
+        TSoftClassPtr<UObject> EffectiveClass;
+        TSharedRef<FLifetimeHandler> LifetimeHandler;
+
+        // when set, instances are created without going through instance factories and dependencies registry
+        const FTypedInstanceCreator* TypedCreator = nullptr;
+        void (*InjectFunction)(UObject& Object, const IResolver& Resolver) = nullptr;
+    };
+
+    using FResolversArray = TArray<FResolver, TInlineAllocator<2>>;
+
+    /*
+     * Registrations of a container, built before container itself.
+     * They do not reference the container, so they can be built on any thread and attached to container later
+     */
+    struct FRegistrationTables
+    {
+        void AddRegistration(UClass* Interface, TSoftClassPtr<UObject> EffectiveClass, const TSharedRef<FLifetimeHandler>& Lifetime, const FTypedInstanceCreator* TypedCreator = nullptr)
+        {
+            Registrations.FindOrAdd(Interface).Emplace(FResolver{ Interface, MoveTemp(EffectiveClass), Lifetime, TypedCreator });
+        }
+
+        void AddKeyedRegistration(UClass* Interface, FName Key, TSoftClassPtr<UObject> EffectiveClass, const TSharedRef<FLifetimeHandler>& Lifetime, const FTypedInstanceCreator* TypedCreator = nullptr)
+        {
+            // last registration wins, same as for Resolve
+            KeyedRegistrations.Add(MakeTuple(Interface, Key), FResolver{ Interface, MoveTemp(EffectiveClass), Lifetime, TypedCreator });
+        }
+
+        void AddNativeRegistration(const FNativeTypeKey* TypeKey, const TSharedRef<FNativeLifetimeHandler>& Lifetime)
+        {
+            // last registration wins, same as for UObject types
+            NativeRegistrations.Add(TypeKey, Lifetime);
+        }
+
+        TMap<UClass*, FResolversArray> Registrations;
+        TMap<TTuple<UClass*, FName>, FResolver> KeyedRegistrations;
+        TMap<const FNativeTypeKey*, TSharedRef<FNativeLifetimeHandler>> NativeRegistrations;
+    };
+}
@@ -0,0 +1,32 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/Impl/IsUInterface.h"
+#include "UObject/ScriptInterface.h"
+
+namespace UnrealDI_Impl
+{
+    /*
+     * Type returned by UObjectContainer::ResolveMany for requested type T.
+     * Matches return type of IResolver::Resolve<T>
+     */
+    template <typename T, typename = void>
+    struct TResolveManyResult;
+
+    template <typename T>
+    struct TResolveManyResult<T, typename TEnableIf< TIsDerivedFrom<T, UObject>::Value >::Type>
+    {
+        using Type = T*;
+
+        static Type Make(UObject* Object) { return (T*)Object; }
+    };
+
+    template <typename T>
+    struct TResolveManyResult<T, typename TEnableIf< TIsUInterface<T>::Value >::Type>
+    {
+        using Type = TScriptInterface<T>;
+
+        static Type Make(UObject* Object) { return Object; }
+    };
+}
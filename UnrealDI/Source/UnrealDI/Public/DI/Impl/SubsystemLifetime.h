@@ -0,0 +1,48 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/Impl/Lifetimes.h"
+
+class UWorld;
+
+namespace UnrealDI_Impl
+{
+    /*
+     * Returns engine subsystem taken from Outer of the container (UWorldSubsystem, UGameInstanceSubsystem or UEngineSubsystem).
+     * Subsystem is looked up only once and then cached until World of the container is cleaned up
+     */
+    class UNREALDI_API FLifetimeHandler_Subsystem : public FLifetimeHandler
+    {
+    public:
+        FLifetimeHandler_Subsystem(UClass* SubsystemClass);
+        ~FLifetimeHandler_Subsystem();
+
+        UObject* Get() override;
+        void Set(UObject* Object) override {}
+        void AddReferencedObjects(FReferenceCollector& Collector) override {}
+        UObject* Peek() override { return CachedSubsystem.Get(); }
+        void OnAddedToContainer(const UObjectContainer& InContainer) override;
+        void OnOuterChanged() override
+        {
+            CachedSubsystem.Reset();
+            CachedWorld.Reset();
+        }
+
+        bool IsShared() const override { return true; }
+        const TCHAR* GetName() const override { return TEXT("Subsystem"); }
+
+    private:
+        UObject* FindSubsystem(UWorld*& OutWorld) const;
+        void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+        UClass* SubsystemClass;
+
+        // handler is owned by container, so it is safe to keep raw pointer here
+        const UObjectContainer* Container = nullptr;
+
+        TWeakObjectPtr<UObject> CachedSubsystem;
+        TWeakObjectPtr<UWorld> CachedWorld;
+        FDelegateHandle WorldCleanupHandle;
+    };
+}
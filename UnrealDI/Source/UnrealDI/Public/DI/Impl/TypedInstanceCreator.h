@@ -0,0 +1,59 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/Impl/DefaultInstanceFactory.h"
+#include "Templates/UnrealTypeTraits.h"
+
+class AActor;
+class UUserWidget;
+
+namespace UnrealDI_Impl
+{
+    /*
+     * Creation functions for a native type, same as UDefaultInstanceFactory would do for it,
+     * but with the kind of object (actor, widget or plain object) decided at compile time
+     */
+    struct UNREALDI_API FTypedInstanceCreator
+    {
+        using FCreateFunctionPtr = UObject* (*)(UObject* Outer);
+        using FFinalizeFunctionPtr = void (*)(UObject& Object);
+
+        FCreateFunctionPtr Create;
+
+        // null if nothing has to be done after injection
+        FFinalizeFunctionPtr Finalize;
+
+        // actor and widget helpers live in a .cpp, so this header does not pull their engine headers
+        static UObject* SpawnActorDeferred(UObject* Outer, UClass* ActorClass);
+        static UObject* CreateUserWidget(UObject* Outer, UClass* WidgetClass);
+        static void FinishSpawning(UObject& Actor);
+    };
+
+    template <typename T>
+    struct TTypedInstanceCreator
+    {
+        static UObject* Create(UObject* Outer)
+        {
+            // if T is an actor or a widget, its own header has already completed AActor or UUserWidget
+            if constexpr (TIsDerivedFrom<T, AActor>::Value)
+            {
+                return FTypedInstanceCreator::SpawnActorDeferred(Outer, T::StaticClass());
+            }
+            else if constexpr (TIsDerivedFrom<T, UUserWidget>::Value)
+            {
+                return FTypedInstanceCreator::CreateUserWidget(Outer, T::StaticClass());
+            }
+            else
+            {
+                return UDefaultInstanceFactory::CreateObject(Outer, T::StaticClass());
+            }
+        }
+
+        static inline const FTypedInstanceCreator Value
+        {
+            &Create,
+            TIsDerivedFrom<T, AActor>::Value ? &FTypedInstanceCreator::FinishSpawning : nullptr
+        };
+    };
+}
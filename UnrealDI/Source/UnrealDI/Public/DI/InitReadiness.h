@@ -0,0 +1,38 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "Tasks/Task.h"
+
+class UObject;
+
+/*
+ * Tracks readiness of objects injected through InitDependencies.
+ * Object is ready when all dependencies passed to its InitDependencies are ready and, if InitDependencies returns UE::Tasks::FTask, that task is completed.
+ * Objects with synchronous InitDependencies are ready once their dependencies are
+ */
+class UNREALDI_API FInitReadiness
+{
+public:
+    /* Returns true if Object has no pending asynchronous initialization */
+    static bool IsReady(const UObject* Object);
+
+    /* Returns task that completes when Object becomes ready. Returned task is already completed if Object is ready */
+    static UE::Tasks::FTask WhenReady(const UObject* Object);
+
+    /* Returns task that completes when all Objects become ready */
+    static UE::Tasks::FTask WhenAllReady(TArrayView<const UObject* const> Objects);
+
+    /* Adds pending initialization of Object to OutTasks, if there is any */
+    static void AppendPending(TArray<UE::Tasks::FTask>& OutTasks, const UObject* Object);
+
+    /* Called by injector after InitDependencies of Object returned. InitTask is default constructed for synchronous InitDependencies */
+    static void Track(const UObject& Object, const UE::Tasks::FTask& InitTask, TArrayView<const UE::Tasks::FTask> DependencyTasks);
+
+    static void Init();
+    static void Shutdown();
+
+private:
+    static void PostGarbageCollect();
+};
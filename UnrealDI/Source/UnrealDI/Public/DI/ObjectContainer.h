@@ -5,15 +5,66 @@
 #include "IResolver.h"
 #include "IInjector.h"
 #include "DI/Impl/InvokeWithDependencies.h"
+#include "DI/Impl/PreparedInvocation.h"
+#include "DI/Impl/RegistrationTables.h"
+#include "DI/Impl/ResolveManyResult.h"
+#include "DI/ObjectsCollection.h"
+#include "DI/ObjectsMap.h"
+#include "DI/ObjectContainerWarmUpManifest.h"
+#include "Tasks/Task.h"
 #include "ObjectContainer.generated.h"
 
 class IInstanceFactory;
+class AActor;
 
 namespace UnrealDI_Impl
 {
     class FLifetimeHandler;
+    class FNativeLifetimeHandler;
+    struct FTypedInstanceCreator;
+    struct FCreationFrame;
+
+    /* Entry of creation order of shared instances. It is stale if lifetime created its instance again after entry was added */
+    struct FCreatedSharedLifetime
+    {
+        TWeakPtr<FLifetimeHandler> Lifetime;
+        uint64 Sequence;
+    };
 }
 
+/*
+ * Result of UObjectContainer::TrimMemory
+ */
+struct FObjectContainerTrimResult
+{
+    /*
+     * Number of instance references dropped by container.
+     * Instances are collected by next GC only if nothing else references them, so this is an upper bound of freed instances
+     */
+    int32 NumReleasedReferences = 0;
+
+    /* Number of class references kept by WarmUp that were dropped. Classes are unloaded only if nothing else references them */
+    int32 NumReleasedClassReferences = 0;
+
+    /* Estimated size of instances whose references were dropped. Upper bound of memory freed by next GC */
+    int64 ReleasedReferencesBytes = 0;
+};
+
+/*
+ * Controls which subobjects are injected together with the object itself
+ */
+enum class EInjectSubobjects : uint8
+{
+    /* Only the object itself is injected */
+    None,
+
+    /* Components of an actor are injected right after the actor itself. Components added by construction script of actor created by container are injected once its spawning is finished */
+    Components,
+
+    /* Components of an actor and default subobjects of any object are injected, recursively */
+    ComponentsAndDefaultSubobjects,
+};
+
 UCLASS()
 class UNREALDI_API UObjectContainer : public UObject, public IResolver, public IInjector
 {
@@ -27,7 +78,11 @@ public:
     UObject* TryResolve(UClass* Type) const override;
     TObjectsCollection<UObject> TryResolveAll(UClass* Type) const override;
     TFactory<UObject> TryResolveFactory(UClass* Type) const override;
+    UObject* ResolveKeyed(UClass* Type, FName Key) const override;
+    UObject* TryResolveKeyed(UClass* Type, FName Key) const override;
+    TObjectsMap<FName, UObject> ResolveMap(UClass* Type) const override;
     bool IsRegistered(UClass* Type) const override;
+    bool TryResolveNative(const UnrealDI_Impl::FNativeTypeKey* TypeKey, void* OutInstance) const override;
 
     using IResolver::Resolve;
     using IResolver::ResolveAll;
@@ -35,7 +90,12 @@ public:
     using IResolver::TryResolve;
     using IResolver::TryResolveAll;
     using IResolver::TryResolveFactory;
+    using IResolver::ResolveKeyed;
+    using IResolver::TryResolveKeyed;
+    using IResolver::ResolveMap;
     using IResolver::IsRegistered;
+    using IResolver::ResolveNative;
+    using IResolver::TryResolveNative;
     // ~End IResolver interface
 
     // ~Begin IInjector interface
@@ -43,6 +103,44 @@ public:
     bool CanInject(UClass* Class) const override;
     // ~End IInjector interface
 
+    /*
+     * Injects dependencies into Object and then into its subobjects selected by Mode.
+     * Components created by construction script do not exist until spawning is finished. Actors created by container get them injected
+     * right after spawning is finished, for other actors they are injected only when Inject is called on already spawned actor. Returns true if anything was injected
+     */
+    bool Inject(UObject* Object, EInjectSubobjects Mode) const;
+
+    /* Returns which subobjects are injected by Inject(Object) and when container creates new instances */
+    EInjectSubobjects GetInjectSubobjects() const { return InjectSubobjectsMode; }
+
+    /*
+     * Resolves instance for each of Types and writes it into OutObjects at the same index.
+     * All registrations are looked up before any instance is created. Asserts once with list of all types that cannot be resolved
+     */
+    void ResolveMany(TArrayView<UClass* const> Types, TArrayView<UObject*> OutObjects) const;
+
+    /*
+     * Resolves instance for each of Types and writes it into OutObjects at the same index, or nullptr if type cannot be resolved.
+     * Returns list of types that were not resolved
+     */
+    TArray<UClass*> TryResolveMany(TArrayView<UClass* const> Types, TArrayView<UObject*> OutObjects) const;
+
+    /*
+     * Resolves instances of all given types at once.
+     * Example:
+     *    auto [Service, OtherService] = Container->ResolveMany<UMyService, IMyOtherService>();
+     */
+    template <typename... T>
+    TTuple<typename UnrealDI_Impl::TResolveManyResult<T>::Type...> ResolveMany() const
+    {
+        UClass* Types[] = { UnrealDI_Impl::TStaticClass< T >::StaticClass()... };
+        UObject* Objects[sizeof...(T)];
+
+        ResolveMany(Types, Objects);
+
+        return MakeResolveManyResult<T...>(Objects, TMakeIntegerSequence<uint32, sizeof...(T)>());
+    }
+
     /*
      * Invokes provided function injecting dependencies into its arguments the same way InitDependencies are usually invoked
      * Example:
@@ -55,32 +153,190 @@ public:
         UnrealDI_Impl::TFunctionWithDependenciesInvokerProvider<TFunction>::Invoker::Invoke(*this, Forward<TFunction>(Function));
     }
 
+    /*
+     * Returns callable that invokes Function with dependencies injected into its arguments, same as InvokeWithDependencies.
+     * Registrations are looked up once here. Instances of shared registrations (e.g. SingleInstance) are taken from their lifetimes
+     * on each call without lookups, other instances (e.g. Transient) are created on each call.
+     * First arguments of Function may be passed on each call instead, their types are listed in TRuntimeArgs.
+     * Returned callable must not be used after container is destroyed
+     * Example:
+     *    auto Tick = Container->PrepareInvocation<float>([](float DeltaTime, UMyService* Service) { Service->Tick(DeltaTime); });
+     *    Tick(DeltaTime);
+     */
+    template <typename... TRuntimeArgs, typename TFunction>
+    typename UnrealDI_Impl::TPreparedInvocationProvider<typename TDecay<TFunction>::Type, TRuntimeArgs...>::Type PrepareInvocation(TFunction&& Function) const
+    {
+        return typename UnrealDI_Impl::TPreparedInvocationProvider<typename TDecay<TFunction>::Type, TRuntimeArgs...>::Type(*this, Forward<TFunction>(Function));
+    }
+
+    /*
+     * Drops references to cached instances that can be recreated on next resolve (e.g. KeepAliveSingleInstance, PerFrame),
+     * to classes kept by WarmUp and to cached lookup tables. Memory is freed by next GC if nothing else references them. SingleInstance and Instance registrations are never released.
+     * Called automatically when engine broadcasts memory trim request
+     */
+    FObjectContainerTrimResult TrimMemory();
+
+    /*
+     * Replaces implementation of registration that Interface resolves to in this container. All interfaces of that registration are switched together.
+     * Instances kept by the registration and by shared registrations that received it (directly or through other registrations) are released,
+     * so they are created again with new implementation. Other registrations keep their instances.
+     * If bRecreateShared is true, released shared instances of this container and its parents are created again right away, dependencies first.
+     * Registrations that do not create instances themselves (Instance, factories, subsystems) can not be replaced. Returns true if registration was replaced
+     */
+    bool ReplaceRegistration(UClass* Interface, TSoftClassPtr<UObject> Implementation, bool bRecreateShared = false);
+
+    /*
+     * Replaces implementation of registration that TInterface resolves to with TImplementation. See ReplaceRegistration above
+     * Example:
+     *    Container->ReplaceRegistration<IMyService, UMyServiceMock>();
+     */
+    template <typename TInterface, typename TImplementation>
+    bool ReplaceRegistration(bool bRecreateShared = false)
+    {
+        static_assert(TIsDerivedFrom<TImplementation, TInterface>::Value, "Implementation type must be derived from Interface type");
+
+        return ReplaceRegistration(UnrealDI_Impl::TStaticClass< TInterface >::StaticClass(), TImplementation::StaticClass(), bRecreateShared);
+    }
+
+    /*
+     * Replaces implementation of registration that TInterface resolves to with Implementation class. See ReplaceRegistration above
+     */
+    template <typename TInterface>
+    bool ReplaceRegistration(TSoftClassPtr<UObject> Implementation, bool bRecreateShared = false)
+    {
+        return ReplaceRegistration(UnrealDI_Impl::TStaticClass< TInterface >::StaticClass(), MoveTemp(Implementation), bRecreateShared);
+    }
+
+    /*
+     * Moves container to new Outer for created objects, e.g. new World after seamless travel, without rebuilding it.
+     * Shared instances bound to old World (actors, widgets and objects created inside old World), and shared instances that received them,
+     * are released and created again on next resolve. Other shared instances are kept. Subsystems are looked up again.
+     * Nested containers that use the same Outer are rebound too. If container was assigned to old World with
+     * FInjectOnConstruction::SetContainerForWorld, it is reassigned to new World
+     */
+    void Rebind(UObject* NewOuterForNewObjects);
+
+    /*
+     * Deterministically tears down this container instead of leaving it to GC.
+     * Nested containers are shut down first and marked as garbage. Then shared instances created by this container are released
+     * in reverse creation order, and those implementing IDisposable are disposed right before release.
+     * If bMarkInstancesAsGarbage is true, released instances are marked as garbage (actors are destroyed), so memory is reclaimed without waiting for references to go away.
+     * Registered instances (Instance, factories, subsystems) are not owned by container and are left untouched.
+     * Container can not resolve anything after shutdown
+     */
+    void Shutdown(bool bMarkInstancesAsGarbage = false);
+
+    /* Returns true if Shutdown was called for this container or its parent */
+    bool IsShutDown() const;
+
+    /*
+     * Spawns one actor of given Type per Transform. All actors are spawned deferred at their final transforms,
+     * then all of them are injected, and then spawning of all of them is finished.
+     * Type must be registered as Transient. Custom instance factories receive transforms through IInstanceFactory::CreateAt
+     */
+    TObjectsCollection<UObject> ResolveActors(UClass* Type, TArrayView<const FTransform> Transforms) const;
+
+    /*
+     * Spawns one actor of type T per Transform. All actors are spawned deferred at their final transforms,
+     * then all of them are injected, and then spawning of all of them is finished.
+     * T must be registered as Transient. Custom instance factories receive transforms through IInstanceFactory::CreateAt
+     */
+    template <typename T>
+    TArray<T*> ResolveActors(TArrayView<const FTransform> Transforms) const
+    {
+        return TObjectsCollection<T>(ResolveActors(UnrealDI_Impl::TStaticClass< T >::StaticClass(), Transforms)).ToArray();
+    }
+
+    /* Returns Outer used for objects created by this container */
+    UObject* GetOuterForNewObjects() const { return OuterForNewObjects; }
+
+    /*
+     * Starts recording registrations of this container in order of their first resolve.
+     * Recording stops automatically after DurationSeconds. If DurationSeconds is 0, it stops only when StopRecordingWarmUp is called
+     */
+    void StartRecordingWarmUp(double DurationSeconds = 0.0);
+
+    /*
+     * Stops recording and writes recorded registrations into Manifest.
+     * Save Manifest as an asset to pass it to WarmUp on later runs
+     */
+    void StopRecordingWarmUp(UObjectContainerWarmUpManifest& OutManifest);
+
+    /*
+     * Loads all classes listed in Manifest and creates shared instances (e.g. SingleInstance) that were not created yet,
+     * including ones registered in parent containers.
+     * Classes that are not loaded yet are loaded asynchronously, instances are created on game thread once all of them are loaded.
+     * Call it during loading, so these objects are not created lazily on first use during gameplay.
+     * Asynchronous InitDependencies of created objects run in parallel. Returned task completes when all instances are created and ready
+     */
+    UE::Tasks::FTask WarmUp(const UObjectContainerWarmUpManifest& Manifest);
+
+    // ~Begin UObject interface
+    void PostInitProperties() override;
+    void BeginDestroy() override;
+    // ~End UObject interface
+
 private:
     friend class FObjectContainerBuilder;
+    friend class FObjectContainerPool;
     friend class FInjectOnConstruction;
+    friend class UnrealDI_Impl::FPreparedObjectSlot;
 
-    struct FResolver
-    {
-        TSoftClassPtr<UObject> EffectiveClass;
-        TSharedRef<UnrealDI_Impl::FLifetimeHandler> LifetimeHandler;
-    };
+    using FResolver = UnrealDI_Impl::FResolver;
+    using FResolversArray = UnrealDI_Impl::FResolversArray;
 
-    void AddRegistration(UClass* Interface, TSoftClassPtr<UObject> EffectiveClass, const TSharedRef< UnrealDI_Impl::FLifetimeHandler >& Lifetime);
+    void AddRegistration(UClass* Interface, TSoftClassPtr<UObject> EffectiveClass, const TSharedRef< UnrealDI_Impl::FLifetimeHandler >& Lifetime, const UnrealDI_Impl::FTypedInstanceCreator* TypedCreator = nullptr);
+    void AttachRegistrationTables(UnrealDI_Impl::FRegistrationTables&& Tables);
     void InitServices();
+    void DisableTypedCreatorsForCustomFactories();
+    template <typename TCallback>
+    void ForEachResolver(TCallback&& Callback);
 
     template <bool bCheck>
     TTuple<const FResolver*, const UObjectContainer*> GetResolver(UClass* Type) const;
     TTuple<const FResolver*, const UObjectContainer*> FindResolver(UClass* Type) const;
+    TTuple<const FResolver*, const UObjectContainer*> FindKeyedResolver(const TTuple<UClass*, FName>& TypeAndKey) const;
+    TTuple<const FResolver*, const UObjectContainer*> FindResolverByLifetime(const UnrealDI_Impl::FLifetimeHandler& LifetimeHandler) const;
+    TSharedPtr<UnrealDI_Impl::FLifetimeHandler> FindSharedLifetime(UClass* Type) const;
     IInstanceFactory* FindInstanceFactory(UClass* Type) const;
+    bool InjectObject(UObject& Object) const;
+    bool InjectSubobjects(UObject& Object, EInjectSubobjects Mode) const;
+    bool InjectInstanceComponents(AActor& Actor, EInjectSubobjects Mode) const;
     static UObject* ResolveImpl(const FResolver& Resolver, const UObjectContainer* OwningContainer);
     template <bool bCheck>
     TObjectsCollection<UObject> ResolveAllImpl(UClass* Type) const;
 
+    template <typename... T, uint32... Indices>
+    static TTuple<typename UnrealDI_Impl::TResolveManyResult<T>::Type...> MakeResolveManyResult(UObject** Objects, TIntegerSequence<uint32, Indices...>)
+    {
+        return MakeTuple(UnrealDI_Impl::TResolveManyResult<T>::Make(Objects[Indices])...);
+    }
+
     void AppendObjectsCollection(UClass* Type, UObject**& Data) const;
 
+    const UObjectContainer& GetRootContainer() const;
+
+    void AddCreatedSharedLifetime(const TSharedRef<UnrealDI_Impl::FLifetimeHandler>& Lifetime) const;
+    void CompactCreatedSharedLifetimes() const;
+
+    void RecordWarmUpEntry(const FResolver& Resolver) const;
+    UE::Tasks::FTask CreateWarmUpInstances(TConstArrayView<FObjectContainerWarmUpEntry> Entries);
+
+    void ShutdownNestedContainers(bool bMarkInstancesAsGarbage);
+    int32 ReleaseCreatedInstances(bool bMarkInstancesAsGarbage);
+    void DetachFromParent();
+    static void ReleaseDependents(TArray<TSharedRef<UnrealDI_Impl::FLifetimeHandler>>& InOutReleased);
+
+    // used by FObjectContainerPool. reset keeps registrations and their storage, attach binds container to a new parent
+    void ResetForReuse();
+    void AttachToParent(UObjectContainer& Parent, UObject* InOuterForNewObjects, EInjectSubobjects InInjectSubobjectsMode);
+
     static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 
+    void OnMemoryTrim();
+
     static UObject* ResolveFromContext(const UObject& Context, UClass& Type);
+    static UObject* ResolveKeyedFromContext(const UObject& Context, UClass& Type, FName Key);
 
     UPROPERTY()
     TObjectPtr<UObject> OuterForNewObjects = nullptr;
@@ -88,7 +344,35 @@ private:
     UPROPERTY()
     TObjectPtr<UObjectContainer> ParentContainer = nullptr;
 
-    using FResolversArray = TArray<FResolver, TInlineAllocator<2>>;
+    EInjectSubobjects InjectSubobjectsMode = EInjectSubobjects::None;
+
     TMap<UClass*, FResolversArray> Registrations;
+    TMap<TTuple<UClass*, FName>, FResolver> KeyedRegistrations;
+    mutable TMap<UClass*, TSharedRef<const UnrealDI_Impl::FObjectsMapIndex>> ObjectsMapIndices;
+    TMap<const UnrealDI_Impl::FNativeTypeKey*, TSharedRef<UnrealDI_Impl::FNativeLifetimeHandler>> NativeRegistrations;
     TArray<TScriptInterface<IInstanceFactory>, TInlineAllocator<4>> InstanceFactories;
+
+    // classes loaded by WarmUp. we keep them until container is destroyed, so they are not collected before first resolve
+    UPROPERTY()
+    TSet<TObjectPtr<UClass>> WarmedUpClasses;
+
+    // shared lifetimes in order their instances were created, oldest first. Shutdown releases them in reverse order
+    // recreated lifetime is added again, its old entry stays in array until compaction
+    mutable TArray<UnrealDI_Impl::FCreatedSharedLifetime> CreatedSharedLifetimes;
+    mutable int32 NumCompactedSharedLifetimes = 0;
+    mutable uint64 LastCreationSequence = 0;
+
+    // innermost instance being created by resolve chain that started in this container or its nested ones. only used in root container
+    mutable UnrealDI_Impl::FCreationFrame* CreationChain = nullptr;
+
+    // containers built with this one as parent. they are shut down together with it
+    TArray<TWeakObjectPtr<UObjectContainer>> NestedContainers;
+    bool bShutDown = false;
+
+    TArray<FObjectContainerWarmUpEntry> RecordedWarmUpEntries;
+    TSet<TTuple<UClass*, FSoftObjectPath>> RecordedWarmUpKeys;
+    double WarmUpRecordingEndTime = 0.0;
+    bool bRecordingWarmUp = false;
+
+    FDelegateHandle MemoryTrimHandle;
 };
@@ -8,11 +8,20 @@
 #include "DI/Impl/RegistrationConfigurator_ForInstance.h"
 #include "DI/Impl/RegistrationConfigurator_ForFactory.h"
 #include "DI/Impl/RegistrationConfigurator_ForCDO.h"
+#include "DI/Impl/RegistrationConfigurator_ForNative.h"
+#include "DI/Impl/RegistrationConfigurator_ForSubsystem.h"
 
 class UObject;
 class UObjectContainer;
 class UGameInstance;
 class UWorld;
+class UObjectContainerDefinition;
+enum class EInjectSubobjects : uint8;
+
+namespace UnrealDI_Impl
+{
+    struct FRegistrationTables;
+}
 
 /*
  * Helper class to simplify construction of UObjectContainer.
@@ -62,6 +71,35 @@ public:
         return AddConfigurator< UnrealDI_Impl::TRegistrationConfigurator_ForCDO< TObject > >();
     }
 
+    /*
+     * Adds registration for engine subsystem TObject (UWorldSubsystem, UGameInstanceSubsystem or UEngineSubsystem).
+     * Subsystem is taken from World or GameInstance of container's Outer and cached until that World is cleaned up.
+     */
+    template<typename TObject>
+    UnrealDI_Impl::TRegistrationConfigurator_ForSubsystem<TObject>& RegisterSubsystem()
+    {
+        return AddConfigurator< UnrealDI_Impl::TRegistrationConfigurator_ForSubsystem< TObject > >();
+    }
+
+    /*
+     * Adds registration for plain C++ type TImpl, that will be resolvable as TSharedRef<TInterface>.
+     * Such services are not UObjects, so they are not tracked by GC and have no reflection overhead.
+     * TImpl may have InitDependencies method. By default objects are handled by Transient lifetime.
+     */
+    template<typename TInterface, typename TImpl = TInterface>
+    UnrealDI_Impl::TRegistrationConfigurator_ForNative<TInterface, TImpl>& RegisterNative()
+    {
+        TSharedRef<UnrealDI_Impl::TRegistrationConfigurator_ForNative<TInterface, TImpl>> Ret = MakeShared<UnrealDI_Impl::TRegistrationConfigurator_ForNative<TInterface, TImpl>>();
+        NativeRegistrations.Emplace(StaticCastSharedRef<UnrealDI_Impl::FNativeRegistrationConfiguratorBase>(Ret));
+        return *Ret;
+    }
+
+    /*
+     * Adds all registrations listed in Definition. They are added after registrations made in code, so they override them.
+     * No configurator objects are created for them. Definition must stay alive until container is built
+     */
+    void RegisterDefinition(const UObjectContainerDefinition& Definition);
+
     /* 
      * Builds a container from all registered types.
      * Outer is used to access current UWorld. If you are creating application-wide container use UGameInstance as an Outer.
@@ -74,12 +112,28 @@ public:
      */
     UObjectContainer* BuildNested(UObjectContainer& Parent);
 
+    /*
+     * Builds a container without blocking the game thread for the whole build.
+     * Registration tables are compiled on a worker thread, then container is created on game thread and OnBuilt is called.
+     * Builder may be destroyed right after this call. Registered definitions and their loaded classes are kept alive until the container is published.
+     * Objects passed to RegisterInstance must stay alive until OnBuilt is called. OnBuilt receives nullptr if Outer was destroyed in the meantime
+     */
+    void BuildAsync(UObject* Outer, TFunction<void(UObjectContainer*)> OnBuilt) const;
+
     /*
      * Overrides Outer for objects created by container. By default they are created in the same Outer as Container
      */
     void SetOuterForNewObjects(UObject* Outer);
 
+    /*
+     * Sets which subobjects are injected together with objects created by container and objects passed to Inject.
+     * By default nothing is injected except the object itself. Nested container uses Parent's value unless overriden
+     */
+    void SetInjectSubobjects(EInjectSubobjects Mode);
+
 private:
+    friend class FObjectContainerPool;
+
     template<typename TConfigurator, typename... TArgs>
     TConfigurator& AddConfigurator(TArgs... Args)
     {
@@ -88,9 +142,27 @@ private:
         return *Ret;
     }
 
-    void AddRegistrationsToContainer(UObjectContainer* Container);
+    // everything compile phase needs from UObjects other than registered classes. defined in cpp
+    struct FCompileInputs;
+
+    // game thread only. finds soft paths and classes of definition entries and checks them. classes are loaded only if bLoad is set
+    FCompileInputs GatherCompileInputs(bool bLoad) const;
+
+    // compile phase. does not look up, load or convert UObjects to soft paths, only reads registered classes and inputs gathered beforehand, so it may run on any thread.
+    // lifetime handlers are created here too, they may subscribe to engine delegates only in OnAddedToContainer
+    void CompileRegistrations(UnrealDI_Impl::FRegistrationTables& Tables, bool bRootContainer, const FCompileInputs& Inputs) const;
+    void CompileDefinitions(UnrealDI_Impl::FRegistrationTables& Tables, const FCompileInputs& Inputs) const;
+
+    // publish phase. game thread only
+    UObjectContainer* BuildNested(UObjectContainer* Container, UObjectContainer& Parent, UObject* OuterOverride) const;
+    void PublishContainer(UObjectContainer* Container, UnrealDI_Impl::FRegistrationTables&& Tables) const;
+    void AutoCreate(UObjectContainer* Container) const;
+    void AutoCreateDefinitions(UObjectContainer* Container) const;
 
     TArray<TSharedRef<UnrealDI_Impl::FRegistrationConfiguratorBase>> Registrations;
+    TArray<TSharedRef<UnrealDI_Impl::FNativeRegistrationConfiguratorBase>> NativeRegistrations;
+    TArray<const UObjectContainerDefinition*> Definitions;
 
     UObject* OuterForNewObjects = nullptr;
+    TOptional<EInjectSubobjects> InjectSubobjectsMode;
 };
@@ -0,0 +1,77 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DataAsset.h"
+#include "Engine/StreamableManager.h"
+#include "Templates/SubclassOf.h"
+#include "UObject/Interface.h"
+#include "ObjectContainerDefinition.generated.h"
+
+/*
+ * Lifetime of registration listed in UObjectContainerDefinition. Matches lifetimes available in FObjectContainerBuilder::RegisterType
+ */
+UENUM(BlueprintType)
+enum class EObjectContainerLifetime : uint8
+{
+    Transient,
+    SingleInstance,
+    WeakSingleInstance,
+    KeepAliveSingleInstance,
+    PerFrame,
+    Prototype,
+};
+
+/*
+ * Single registration listed in UObjectContainerDefinition
+ */
+USTRUCT(BlueprintType)
+struct UNREALDI_API FObjectContainerDefinitionEntry
+{
+    GENERATED_BODY()
+
+    /* Class that is instantiated for this registration */
+    UPROPERTY(EditAnywhere, Category = "Registration")
+    TSoftClassPtr<UObject> Implementation;
+
+    /* Interfaces this registration is resolvable as. If empty, registration is resolvable as Implementation itself */
+    UPROPERTY(EditAnywhere, Category = "Registration")
+    TArray<TSubclassOf<UInterface>> Interfaces;
+
+    UPROPERTY(EditAnywhere, Category = "Registration")
+    EObjectContainerLifetime Lifetime = EObjectContainerLifetime::Transient;
+
+    /* How long instance is kept alive after its last resolve, in seconds. 0 means no time limit */
+    UPROPERTY(EditAnywhere, Category = "Registration", meta = (EditCondition = "Lifetime == EObjectContainerLifetime::KeepAliveSingleInstance", EditConditionHides, ClampMin = 0))
+    float KeepAliveSeconds = 0.f;
+
+    /* How many garbage collections instance survives after its last resolve. 0 means no limit */
+    UPROPERTY(EditAnywhere, Category = "Registration", meta = (EditCondition = "Lifetime == EObjectContainerLifetime::KeepAliveSingleInstance", EditConditionHides, ClampMin = 0))
+    int32 KeepAliveGCCycles = 0;
+
+    /* If set, registration is resolvable only through ResolveKeyed and ResolveMap */
+    UPROPERTY(EditAnywhere, Category = "Registration")
+    FName Key;
+
+    /* Whether instance is created right after container is built */
+    UPROPERTY(EditAnywhere, Category = "Registration")
+    bool bAutoCreate = false;
+};
+
+/*
+ * List of registrations that can be edited without recompiling and added to container with FObjectContainerBuilder::RegisterDefinition.
+ * Implementation classes are referenced softly, so loading this asset loads no services.
+ * Call LoadClassesAsync before building the container to avoid synchronous loads on first resolve
+ */
+UCLASS(BlueprintType)
+class UNREALDI_API UObjectContainerDefinition : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, Category = "Registration")
+    TArray<FObjectContainerDefinitionEntry> Entries;
+
+    /* Requests asynchronous load of all Implementation classes. OnLoaded is called when all of them are loaded */
+    TSharedPtr<FStreamableHandle> LoadClassesAsync(FStreamableDelegate OnLoaded) const;
+};
@@ -0,0 +1,56 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/GCObject.h"
+#include "DI/ObjectContainerBuilder.h"
+
+class UObjectContainer;
+
+/*
+ * Keeps nested containers built from the same builder, so short-lived containers (e.g. per match or per connection) can be reused.
+ * Released container drops all instances it created, but keeps its registrations and their storage.
+ * Acquired container is bound to new Parent and Outer, and its bAutoCreate registrations are resolved again.
+ * Pool is emptied when engine broadcasts memory trim request
+ */
+class UNREALDI_API FObjectContainerPool : public FGCObject
+{
+public:
+    /*
+     * Builder is copied, so it may be destroyed right away. Objects passed to RegisterInstance and definitions must stay alive while pool is used.
+     * MaxPooledContainers limits number of containers waiting for reuse
+     */
+    explicit FObjectContainerPool(const FObjectContainerBuilder& InBuilder, int32 InMaxPooledContainers = 8);
+    ~FObjectContainerPool();
+
+    /*
+     * Returns nested container of Parent, either pooled one or newly built.
+     * OuterForNewObjects overrides Outer set in builder. If neither is given, Parent's Outer is used, same as for BuildNested
+     */
+    UObjectContainer* Acquire(UObjectContainer& Parent, UObject* OuterForNewObjects = nullptr);
+
+    /*
+     * Returns container to the pool. Container must be acquired from this pool and must not be used after this call.
+     * Shared instances are released the same way as in UObjectContainer::Shutdown, disposing them in reverse creation order.
+     * If pool is full, container is shut down instead
+     */
+    void Release(UObjectContainer* Container);
+
+    /* Shuts down all pooled containers */
+    void Empty();
+
+    /* Returns number of containers waiting for reuse */
+    int32 GetNumPooled() const { return PooledContainers.Num(); }
+
+    // ~Begin FGCObject interface
+    void AddReferencedObjects(FReferenceCollector& Collector) override;
+    FString GetReferencerName() const override;
+    // ~End FGCObject interface
+
+private:
+    FObjectContainerBuilder Builder;
+    TArray<TObjectPtr<UObjectContainer>> PooledContainers;
+    int32 MaxPooledContainers;
+
+    FDelegateHandle MemoryTrimHandle;
+};
@@ -0,0 +1,41 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DataAsset.h"
+#include "ObjectContainerWarmUpManifest.generated.h"
+
+/*
+ * Single registration that was resolved while recording warm up manifest
+ */
+USTRUCT()
+struct UNREALDI_API FObjectContainerWarmUpEntry
+{
+    GENERATED_BODY()
+
+    /* Type that was requested from container */
+    UPROPERTY(VisibleAnywhere, Category = "Warm Up")
+    TSoftClassPtr<UObject> Interface;
+
+    /* Class that was instantiated for this registration */
+    UPROPERTY(VisibleAnywhere, Category = "Warm Up")
+    TSoftClassPtr<UObject> EffectiveClass;
+
+    /* Whether registration shares single instance between all resolves, e.g. SingleInstance */
+    UPROPERTY(VisibleAnywhere, Category = "Warm Up")
+    bool bShared = false;
+};
+
+/*
+ * List of registrations resolved from container during first seconds of a session, in order of their first resolve.
+ * Record it with UObjectContainer::StartRecordingWarmUp / StopRecordingWarmUp and pass to UObjectContainer::WarmUp on later runs
+ */
+UCLASS()
+class UNREALDI_API UObjectContainerWarmUpManifest : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(VisibleAnywhere, Category = "Warm Up")
+    TArray<FObjectContainerWarmUpEntry> Entries;
+};
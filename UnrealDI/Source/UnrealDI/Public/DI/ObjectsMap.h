@@ -0,0 +1,156 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "DI/Impl/IsUInterface.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UnrealTypeTraits.h"
+#include "UObject/NameTypes.h"
+#include "UObject/ScriptInterface.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+namespace UnrealDI_Impl
+{
+    /*
+     * Keys of all keyed registrations of some Type visible from a container.
+     * It is computed once per container and shared between all TObjectsMap instances of that Type
+     */
+    struct FObjectsMapIndex
+    {
+        UClass* Type = nullptr;
+        TArray<FName> Keys;
+        TMap<FName, int32> KeyToIndex;
+    };
+}
+
+/*
+ * Contains objects registered with .Keyed(Key), mapped by their keys.
+ * Object is resolved on each Find of its key according to lifetime of its registration (e.g. Transient creates new object on each Find,
+ * SingleInstance returns the same one), entries that are never found are never created.
+ * Depending on a T it will return either T* or TScriptInterface<T>
+ */
+template <typename TKey, typename T>
+class TObjectsMap
+{
+    static_assert(TIsSame<TKey, FName>::Value, "Only FName keys are supported by TObjectsMap");
+
+public:
+    using FResolveFunctionPtr = UObject* (*)(const UObject& Context, UClass& ObjectClass, FName Key);
+
+    /*
+     * Constructs empty map
+     */
+    TObjectsMap() = default;
+
+    TObjectsMap(const UObject& Object, FResolveFunctionPtr ResolveFunction, TSharedRef<const UnrealDI_Impl::FObjectsMapIndex> InIndex)
+        : WeakContextObject(&Object)
+        , ResolveFunction(ResolveFunction)
+        , Index(MoveTemp(InIndex))
+    {
+    }
+
+    /*
+     * Move constructs from other map
+     */
+    template <typename U>
+    TObjectsMap(TObjectsMap<TKey, U>&& Other)
+        : WeakContextObject(Other.WeakContextObject)
+        , ResolveFunction(Other.ResolveFunction)
+        , Index(MoveTemp(Other.Index))
+    {
+    }
+
+    /*
+     * Returns amount of keys in a map.
+     */
+    int32 Num() const
+    {
+        return Index ? Index->Keys.Num() : 0;
+    }
+
+    /*
+     * Returns true if map has an entry with given Key.
+     */
+    bool Contains(FName Key) const
+    {
+        return Index && Index->KeyToIndex.Contains(Key);
+    }
+
+    /*
+     * Returns all keys of this map.
+     */
+    TArrayView<const FName> GetKeys() const
+    {
+        return Index ? TArrayView<const FName>(Index->Keys) : TArrayView<const FName>();
+    }
+
+    /*
+     * Returns object mapped to Key. Returns nullptr if there is no such Key
+     */
+    auto Find(FName Key) const
+    {
+        UE_STATIC_ASSERT_COMPLETE_TYPE(T, "Type T in TObjectsMap<TKey, T> must be fully defined when calling Find(), not just forward declared. Are you missing an #include?");
+
+        const int32* EntryIndex = Index ? Index->KeyToIndex.Find(Key) : nullptr;
+        return Cast(EntryIndex ? Resolve(*EntryIndex) : nullptr);
+    }
+
+    /*
+     * Returns object mapped to Key. Asserts if there is no such Key
+     */
+    auto FindChecked(FName Key) const
+    {
+        UE_STATIC_ASSERT_COMPLETE_TYPE(T, "Type T in TObjectsMap<TKey, T> must be fully defined when calling FindChecked(), not just forward declared. Are you missing an #include?");
+
+        const int32* EntryIndex = Index ? Index->KeyToIndex.Find(Key) : nullptr;
+        checkf(EntryIndex != nullptr, TEXT("TObjectsMap has no entry with key %s"), *Key.ToString());
+
+        return Cast(Resolve(*EntryIndex));
+    }
+
+    // Non-copyable
+    TObjectsMap(const TObjectsMap&) = delete;
+    TObjectsMap& operator=(const TObjectsMap&) = delete;
+
+    template <typename U>
+    TObjectsMap& operator=(TObjectsMap<TKey, U>&& Other)
+    {
+        WeakContextObject = Other.WeakContextObject;
+        ResolveFunction = Other.ResolveFunction;
+        Index = MoveTemp(Other.Index);
+        return *this;
+    }
+
+private:
+    template <typename, typename> friend class TObjectsMap;
+
+    UObject* Resolve(int32 EntryIndex) const
+    {
+        // instances are not cached here, so released or replaced registrations are picked up right away
+        const UObject* ContextObject = WeakContextObject.Get();
+        checkf(ContextObject != nullptr, TEXT("TObjectsMap accessed after UObjectContainer was destroyed"));
+
+        return ResolveFunction(*ContextObject, *Index->Type, Index->Keys[EntryIndex]);
+    }
+
+    auto Cast(UObject* Object) const
+    {
+        if constexpr (TIsDerivedFrom< T, UObject >::Value)
+        {
+            return (T*)Object;
+        }
+        else if constexpr (UnrealDI_Impl::TIsUInterface< T >::Value)
+        {
+            return TScriptInterface< T >(Object);
+        }
+        else
+        {
+            return Object;
+        }
+    }
+
+    TWeakObjectPtr<const UObject> WeakContextObject;
+    FResolveFunctionPtr ResolveFunction = nullptr;
+    TSharedPtr<const UnrealDI_Impl::FObjectsMapIndex> Index;
+};
@@ -12,6 +12,7 @@ public class UnrealDI : ModuleRules
 			new []
 			{
 				"Core",
+				"Engine",
 				"UMG",
 				// ... add other public dependencies that you statically link with here ...
 			});
@@ -20,7 +21,6 @@ public class UnrealDI : ModuleRules
 			new []
 			{
 				"CoreUObject",
-				"Engine",
 				// ... add private dependencies that you statically link with here ...	
 			});
 	}
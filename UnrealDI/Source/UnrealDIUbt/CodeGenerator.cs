@@ -20,7 +20,8 @@ public static class CodeGenerator
     struct ClassEntry
     {
         public UhtClass Class;
-        public List<UhtClass> Dependencies;
+        public List<UhtClass>? Dependencies;
+        public List<string> InjectedProperties;
     };
 
     enum InitDependenciesFindResult
@@ -99,17 +100,15 @@ public static class CodeGenerator
 
             foreach (UhtClass uhtClass in header.Children.OfType<UhtClass>())
             {
-                if (uhtClass.MetaData.ContainsKey("NoInitDependencies"))
-                {
-                    // skip classes marked with NoInitDependencies metadata
-                    continue;
-                }
+                // skip classes marked with NoInitDependencies metadata
+                var dependencies = uhtClass.MetaData.ContainsKey("NoInitDependencies") ? null : FindClassDependencies(uhtClass, factory.Session);
 
-                var dependencies = FindClassDependencies(uhtClass, factory.Session);
+                // property metadata is stripped from cooked builds, so injected fields are listed in generated code
+                var injectedProperties = FindInjectedProperties(uhtClass);
 
-                if (dependencies != null)
+                if (dependencies != null || injectedProperties.Count > 0)
                 {
-                    result.Add(new ClassEntry { Class = uhtClass, Dependencies = dependencies });
+                    result.Add(new ClassEntry { Class = uhtClass, Dependencies = dependencies, InjectedProperties = injectedProperties });
                 }
             }
         }
@@ -124,7 +123,7 @@ public static class CodeGenerator
         foreach (var classesPerModule in affectedClasses.GroupBy(c => c.Class.Package.Module))
         {
             var sortedIncludeFiles = classesPerModule
-                .SelectMany(entry => entry.Dependencies.Select(d => d.HeaderFile).Prepend(entry.Class.HeaderFile))
+                .SelectMany(entry => (entry.Dependencies ?? new()).Select(d => d.HeaderFile).Prepend(entry.Class.HeaderFile))
                 .Distinct()
                 .OrderBy(f => GetProperIncludePath(f))
                 .ToArray();
@@ -159,10 +158,29 @@ public static class CodeGenerator
 
             foreach (ClassEntry entry in sortedClasses)
             {
-                sb.Append("EXPOSE_DEPENDENCIES_INTERNAL(");
-                sb.Append(entry.Class.SourceName);
-                sb.Append(");");
-                sb.AppendLine();
+                if (entry.Dependencies != null)
+                {
+                    sb.Append("EXPOSE_DEPENDENCIES_INTERNAL(");
+                    sb.Append(entry.Class.SourceName);
+                    sb.Append(");");
+                    sb.AppendLine();
+                }
+
+                if (entry.InjectedProperties.Count > 0)
+                {
+                    sb.Append("EXPOSE_INJECTED_PROPERTIES_INTERNAL(");
+                    sb.Append(entry.Class.SourceName);
+
+                    foreach (string propertyName in entry.InjectedProperties)
+                    {
+                        sb.Append(", TEXT(\"");
+                        sb.Append(propertyName);
+                        sb.Append("\")");
+                    }
+
+                    sb.Append(");");
+                    sb.AppendLine();
+                }
             }
 
 #if UE_5_5_OR_LATER
@@ -235,7 +253,17 @@ public static class CodeGenerator
         return result;
     }
 
-    private static bool IsValidDeclaration(UhtClass uhtClass, IUhtTokenReader tokenReader)
+    private static List<string> FindInjectedProperties(UhtClass uhtClass)
+    {
+        // only properties declared in this class. inherited ones are listed for their own classes
+        return uhtClass.Children
+            .OfType<UhtProperty>()
+            .Where(p => p.MetaData.ContainsKey("Inject"))
+            .Select(p => p.EngineName)
+            .ToList();
+    }
+
+        private static bool IsValidDeclaration(UhtClass uhtClass, IUhtTokenReader tokenReader)
     {
         var errorLine = tokenReader.InputLine;
 
@@ -251,9 +279,9 @@ public static class CodeGenerator
             return false;
         }
 
-        if (!tokenReader.TryOptional("void"))
+        if (!tokenReader.TryOptional("void") && !TryReadTaskType(tokenReader))
         {
-            uhtClass.LogError(errorLine, "InitDependencies must return void");
+            uhtClass.LogError(errorLine, "InitDependencies must return void or UE::Tasks::FTask");
             return false;
         }
 
@@ -272,6 +300,28 @@ public static class CodeGenerator
         return true;
     }
 
+    private static bool TryReadTaskType(IUhtTokenReader tokenReader)
+    {
+        // accepts UE::Tasks::FTask, Tasks::FTask and FTask
+        if (tokenReader.TryOptional("UE"))
+        {
+            if (!tokenReader.TryOptional("::"))
+            {
+                return false;
+            }
+        }
+
+        if (tokenReader.TryOptional("Tasks"))
+        {
+            if (!tokenReader.TryOptional("::"))
+            {
+                return false;
+            }
+        }
+
+        return tokenReader.TryOptional("FTask");
+    }
+
     private static InitDependenciesFindResult FindInitDependenciesDeclaration(UhtClass uhtClass, out UhtDeclaration foundDeclaration)
     {
         if (uhtClass.Declarations == null)
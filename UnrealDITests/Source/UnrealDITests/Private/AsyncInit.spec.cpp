@@ -0,0 +1,102 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+#include "DI/InitReadiness.h"
+
+#include "MockClasses_AsyncInit.h"
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FAsyncInitSpec, "UnrealDI.AsyncInit", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FAsyncInitSpec)
+
+void FAsyncInitSpec::Define()
+{
+    It("Should Treat Objects With Synchronous Init As Ready", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        TestTrue("Ready", FInitReadiness::IsReady(Container->Resolve<UMockReader>()));
+    });
+
+    It("Should Become Ready When Init Task Completes", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        Builder.RegisterType<UAsyncInitService>();
+        UObjectContainer* Container = Builder.Build();
+
+        UAsyncInitService* Service = Container->Resolve<UAsyncInitService>();
+
+        TestNotNull("Reader", Service->Reader.GetObject());
+        TestFalse("Ready before completion", FInitReadiness::IsReady(Service));
+
+        Service->CompleteInit();
+        FInitReadiness::WhenReady(Service).Wait();
+
+        TestTrue("Ready after completion", FInitReadiness::IsReady(Service));
+    });
+
+    It("Should Wait For Dependencies Readiness", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        Builder.RegisterType<UAsyncInitService>().SingleInstance();
+        Builder.RegisterType<UAsyncInitDependent>();
+        UObjectContainer* Container = Builder.Build();
+
+        UAsyncInitDependent* Dependent = Container->Resolve<UAsyncInitDependent>();
+
+        TestFalse("Ready before dependency completion", FInitReadiness::IsReady(Dependent));
+
+        Dependent->Service->CompleteInit();
+        FInitReadiness::WhenReady(Dependent).Wait();
+
+        TestTrue("Ready after dependency completion", FInitReadiness::IsReady(Dependent));
+    });
+
+    It("Should Keep Object With Synchronous Init Pending Until Dependencies Are Ready", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        Builder.RegisterType<UAsyncInitService>().SingleInstance();
+        Builder.RegisterType<USyncInitDependent>();
+        UObjectContainer* Container = Builder.Build();
+
+        USyncInitDependent* Dependent = Container->Resolve<USyncInitDependent>();
+
+        TestNotNull("Service", Dependent->Service.Get());
+        TestFalse("Ready before dependency completion", FInitReadiness::IsReady(Dependent));
+
+        Dependent->Service->CompleteInit();
+        FInitReadiness::WhenReady(Dependent).Wait();
+
+        TestTrue("Ready after dependency completion", FInitReadiness::IsReady(Dependent));
+    });
+
+    It("Should Return WarmUp Task That Completes When All Instances Are Ready", [this]
+    {
+        UObjectContainerWarmUpManifest* Manifest = NewObject<UObjectContainerWarmUpManifest>();
+        FObjectContainerWarmUpEntry& Entry = Manifest->Entries.Emplace_GetRef();
+        Entry.Interface = UAsyncInitService::StaticClass();
+        Entry.EffectiveClass = UAsyncInitService::StaticClass();
+        Entry.bShared = true;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        Builder.RegisterType<UAsyncInitService>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UE::Tasks::FTask WarmUpTask = Container->WarmUp(*Manifest);
+        TestFalse("Completed before init", WarmUpTask.IsCompleted());
+
+        Container->Resolve<UAsyncInitService>()->CompleteInit();
+
+        TestTrue("Completed after init", WarmUpTask.Wait(FTimespan::FromSeconds(5.0)));
+    });
+}
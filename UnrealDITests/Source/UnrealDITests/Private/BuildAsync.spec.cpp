@@ -0,0 +1,86 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+#include "DI/ObjectContainerDefinition.h"
+#include "UObject/StrongObjectPtr.h"
+
+#include "MockClasses.h"
+#include "MockReader.h"
+#include "MockSubsystem.h"
+#include "TempWorldHelper.h"
+
+BEGIN_DEFINE_SPEC(FBuildAsyncSpec, "UnrealDI.BuildAsync", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FBuildAsyncSpec)
+
+void FBuildAsyncSpec::Define()
+{
+    LatentIt("Should Build Container With All Registrations", [this](const FDoneDelegate& Done)
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UNeedInterfaceInstance>();
+
+        Builder.BuildAsync(nullptr, [this, Done](UObjectContainer* Container)
+        {
+            TestTrue("Game thread", IsInGameThread());
+
+            if (TestNotNull("Container", Container))
+            {
+                TestNotNull("Reader", Container->Resolve<IReader>().GetObject());
+                TestNotNull("Dependency injected", Container->Resolve<UNeedInterfaceInstance>()->Instance.GetObject());
+                TestEqual("Resolver", Container->Resolve<IResolver>().GetObject(), static_cast<UObject*>(Container));
+            }
+
+            Done.Execute();
+        });
+    });
+
+    LatentIt("Should Build Container With Subsystem And Definition", [this](const FDoneDelegate& Done)
+    {
+        // world and definition must outlive the build
+        TSharedRef<FTempWorldHelper> Helper = MakeShared<FTempWorldHelper>();
+        TStrongObjectPtr<UObjectContainerDefinition> Definition(NewObject<UObjectContainerDefinition>());
+
+        FObjectContainerDefinitionEntry& Entry = Definition->Entries.Emplace_GetRef();
+        Entry.Implementation = UMockReader::StaticClass();
+        Entry.Key = TEXT("Primary");
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterSubsystem<UMockWorldSubsystem>().As<IReader>();
+        Builder.RegisterDefinition(*Definition);
+
+        Builder.BuildAsync(Helper->World, [this, Done, Helper, Definition](UObjectContainer* Container)
+        {
+            if (TestNotNull("Container", Container))
+            {
+                TestEqual("Subsystem", Container->Resolve<IReader>().GetObject(), (UObject*)Helper->World->GetSubsystem<UMockWorldSubsystem>());
+                TestNotNull("Definition registration", Container->TryResolveKeyed<UMockReader>(TEXT("Primary")));
+            }
+
+            Done.Execute();
+        });
+    });
+
+    LatentIt("Should Auto Create Instances After Publish", [this](const FDoneDelegate& Done)
+    {
+        TArray<UObject*> ReadersBefore;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersBefore);
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().SingleInstance(true);
+
+        Builder.BuildAsync(nullptr, [this, Done, NumBefore = ReadersBefore.Num()](UObjectContainer* Container)
+        {
+            TArray<UObject*> ReadersAfter;
+            GetObjectsOfClass(UMockReader::StaticClass(), ReadersAfter);
+
+            TestEqual("Created objects Num", ReadersAfter.Num() - NumBefore, 1);
+
+            Done.Execute();
+        });
+    });
+}
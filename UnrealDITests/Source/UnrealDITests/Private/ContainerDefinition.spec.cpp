@@ -0,0 +1,87 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+#include "DI/ObjectContainerDefinition.h"
+
+#include "MockClasses.h"
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FContainerDefinitionSpec, "UnrealDI.ContainerDefinition", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FContainerDefinitionSpec)
+
+void FContainerDefinitionSpec::Define()
+{
+    It("Should Register Implementation By Interface", [this]
+    {
+        UObjectContainerDefinition* Definition = NewObject<UObjectContainerDefinition>();
+        FObjectContainerDefinitionEntry& Entry = Definition->Entries.Emplace_GetRef();
+        Entry.Implementation = UMockReader::StaticClass();
+        Entry.Interfaces.Add(UReader::StaticClass());
+        Entry.Lifetime = EObjectContainerLifetime::SingleInstance;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterDefinition(*Definition);
+        UObjectContainer* Container = Builder.Build();
+
+        TScriptInterface<IReader> Reader = Container->Resolve<IReader>();
+
+        TestTrue("Resolved MockReader", Reader.GetObject() != nullptr && Reader.GetObject()->IsA<UMockReader>());
+        TestEqual("Same instance", Container->Resolve<IReader>().GetObject(), Reader.GetObject());
+    });
+
+    It("Should Register Implementation As Self With Key", [this]
+    {
+        UObjectContainerDefinition* Definition = NewObject<UObjectContainerDefinition>();
+        FObjectContainerDefinitionEntry& Entry = Definition->Entries.Emplace_GetRef();
+        Entry.Implementation = UMockReader::StaticClass();
+        Entry.Key = TEXT("Primary");
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterDefinition(*Definition);
+        UObjectContainer* Container = Builder.Build();
+
+        TestNotNull("Resolved keyed", Container->TryResolveKeyed<UMockReader>(TEXT("Primary")));
+        TestNull("Resolved other key", Container->TryResolveKeyed<UMockReader>(TEXT("Secondary")));
+    });
+
+    It("Should Override Registrations Made In Code", [this]
+    {
+        UObjectContainerDefinition* Definition = NewObject<UObjectContainerDefinition>();
+        FObjectContainerDefinitionEntry& Entry = Definition->Entries.Emplace_GetRef();
+        Entry.Implementation = UMockReader::StaticClass();
+        Entry.Interfaces.Add(UReader::StaticClass());
+        Entry.Lifetime = EObjectContainerLifetime::SingleInstance;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        Builder.RegisterDefinition(*Definition);
+        UObjectContainer* Container = Builder.Build();
+
+        TestEqual("Same instance", Container->Resolve<IReader>().GetObject(), Container->Resolve<IReader>().GetObject());
+    });
+
+    It("Should Auto Create Instances", [this]
+    {
+        UObjectContainerDefinition* Definition = NewObject<UObjectContainerDefinition>();
+        FObjectContainerDefinitionEntry& Entry = Definition->Entries.Emplace_GetRef();
+        Entry.Implementation = UMockReader::StaticClass();
+        Entry.Lifetime = EObjectContainerLifetime::SingleInstance;
+        Entry.bAutoCreate = true;
+
+        TArray<UObject*> ReadersBefore;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersBefore);
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterDefinition(*Definition);
+        UObjectContainer* Container = Builder.Build();
+
+        TArray<UObject*> ReadersAfter;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersAfter);
+
+        TestEqual("Created objects Num", ReadersAfter.Num() - ReadersBefore.Num(), 1);
+    });
+}
@@ -0,0 +1,90 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainerPool.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockClasses.h"
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FContainerPoolSpec, "UnrealDI.ContainerPool", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FContainerPoolSpec)
+
+void FContainerPoolSpec::Define()
+{
+    It("Should Reuse Released Container", [this]
+    {
+        UObjectContainer* Parent = FObjectContainerBuilder().Build();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().SingleInstance();
+        FObjectContainerPool Pool(Builder);
+
+        UObjectContainer* First = Pool.Acquire(*Parent);
+        Pool.Release(First);
+
+        TestEqual("Pooled Num", Pool.GetNumPooled(), 1);
+        TestEqual("Acquired same container", Pool.Acquire(*Parent), First);
+        TestEqual("Pooled Num after acquire", Pool.GetNumPooled(), 0);
+    });
+
+    It("Should Release Shared Instances When Container Is Released", [this]
+    {
+        UObjectContainer* Parent = FObjectContainerBuilder().Build();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().SingleInstance();
+        FObjectContainerPool Pool(Builder);
+
+        UObjectContainer* Container = Pool.Acquire(*Parent);
+        UMockReader* OldReader = Container->Resolve<UMockReader>();
+        Pool.Release(Container);
+
+        Container = Pool.Acquire(*Parent);
+        TestNotEqual("Resolved same object", Container->Resolve<UMockReader>(), OldReader);
+    });
+
+    It("Should Resolve From New Parent", [this]
+    {
+        UMockReader* Reader1 = NewObject<UMockReader>();
+        UMockReader* Reader2 = NewObject<UMockReader>();
+
+        FObjectContainerBuilder ParentBuilder1;
+        ParentBuilder1.RegisterInstance<UMockReader>(Reader1).As<IReader>();
+        UObjectContainer* Parent1 = ParentBuilder1.Build();
+
+        FObjectContainerBuilder ParentBuilder2;
+        ParentBuilder2.RegisterInstance<UMockReader>(Reader2).As<IReader>();
+        UObjectContainer* Parent2 = ParentBuilder2.Build();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UNeedInterfaceInstance>().SingleInstance();
+        FObjectContainerPool Pool(Builder);
+
+        UObjectContainer* Container = Pool.Acquire(*Parent1);
+        TestEqual("Resolved from first parent", Container->Resolve<UNeedInterfaceInstance>()->Instance.GetObject(), (UObject*)Reader1);
+        Pool.Release(Container);
+
+        Container = Pool.Acquire(*Parent2);
+        TestEqual("Resolved from second parent", Container->Resolve<UNeedInterfaceInstance>()->Instance.GetObject(), (UObject*)Reader2);
+    });
+
+    It("Should Shut Down Containers Over The Limit", [this]
+    {
+        UObjectContainer* Parent = FObjectContainerBuilder().Build();
+
+        FObjectContainerPool Pool(FObjectContainerBuilder(), 1);
+
+        UObjectContainer* First = Pool.Acquire(*Parent);
+        UObjectContainer* Second = Pool.Acquire(*Parent);
+        Pool.Release(First);
+        Pool.Release(Second);
+
+        TestEqual("Pooled Num", Pool.GetNumPooled(), 1);
+        TestFalse("First is shut down", First->IsShutDown());
+        TestTrue("Second is shut down", Second->IsShutDown());
+    });
+}
@@ -125,6 +125,37 @@ void FIInstanceFactorySpec::Define()
         TestEqual("Created objects Num", Factory->CreatedObjects.Num(), 0);
     });
 
+    It("Should use IInstanceFactory for explicitly registered type", [this]
+    {
+        UTestInstanceFactory* Factory = NewObject<UTestInstanceFactory>();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance(Factory).As<IInstanceFactory>();
+        Builder.RegisterType<UTestInstanceFactoryObject>();
+
+        UObjectContainer* Container = Builder.Build();
+
+        UTestInstanceFactoryObject* Resolved = Container->Resolve<UTestInstanceFactoryObject>();
+
+        TestEqual("CreatedBy", Resolved->CreatedBy, Factory);
+        TestTrue("Finalize called", Resolved->bFinalizeCalled);
+    });
+
+    It("Should spawn and inject explicitly registered actor type", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<AInjectActor>();
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        AInjectActor* Resolved = Container->Resolve<AInjectActor>();
+
+        TestEqual("Actor World", Resolved->GetWorld(), Helper.World);
+        TestTrue("Actor spawning finished", Resolved->HasActorBegunPlay() || Resolved->IsActorInitialized());
+        TestEqual("Resolver", Resolved->Resolver, TScriptInterface<IResolver>(Container));
+    });
+
     It("Should give fixed name to first created object", [this]
     {
         FTempWorldHelper Helper;
@@ -11,6 +11,32 @@
 #include "BuildContainerHelper.h"
 #include "LatentCommands.h"
 
+namespace IResolverSpecImpl
+{
+    /* Resolver implemented outside of the plugin, that overrides only methods it needs */
+    class FMinimalResolver : public IResolver
+    {
+    public:
+        explicit FMinimalResolver(const UObjectContainer& InContainer)
+            : Container(InContainer)
+        {
+        }
+
+        UObject* Resolve(UClass* Type) const override { return Container.Resolve(Type); }
+        TObjectsCollection<UObject> ResolveAll(UClass* Type) const override { return Container.ResolveAll(Type); }
+        TFactory<UObject> ResolveFactory(UClass* Type) const override { return Container.ResolveFactory(Type); }
+        UObject* TryResolve(UClass* Type) const override { return Container.TryResolve(Type); }
+        TObjectsCollection<UObject> TryResolveAll(UClass* Type) const override { return Container.TryResolveAll(Type); }
+        TFactory<UObject> TryResolveFactory(UClass* Type) const override { return Container.TryResolveFactory(Type); }
+        bool IsRegistered(UClass* Type) const override { return Container.IsRegistered(Type); }
+
+    private:
+        const UObjectContainer& Container;
+    };
+}
+
+using namespace IResolverSpecImpl;
+
 BEGIN_DEFINE_SPEC(IResolverSpec, "UnrealDI.IResolver", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
 END_DEFINE_SPEC(IResolverSpec)
 
@@ -60,4 +86,19 @@ void IResolverSpec::Define()
         TestTrue("Resolve returned invalid collection", Readers.IsValid());
         TestTrue("Resolve returned empty collection", Readers.Num() > 0);
     });
-}
\ No newline at end of file
+
+    It("Should Not Resolve Keyed From Resolver Without Keyed Registrations", [this]()
+    {
+        FMinimalResolver Resolver(*FBuildContainerHelper::Build());
+
+        TestNull("TryResolveKeyed returned object", Resolver.TryResolveKeyed(UMockReader::StaticClass(), TEXT("Key")));
+        TestFalse("TryResolveNative resolved", Resolver.TryResolveNative<FString>().IsValid());
+    });
+
+    It("Should Resolve Empty Map From Resolver Without Keyed Registrations", [this]()
+    {
+        FMinimalResolver Resolver(*FBuildContainerHelper::Build());
+
+        TestEqual("Map Num", Resolver.ResolveMap(UMockReader::StaticClass()).Num(), 0);
+    });
+}
@@ -0,0 +1,141 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "TempWorldHelper.h"
+#include "MockClasses_Actors.h"
+
+BEGIN_DEFINE_SPEC(FInjectSubobjectsSpec, "UnrealDI.InjectSubobjects", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FInjectSubobjectsSpec)
+
+void FInjectSubobjectsSpec::Define()
+{
+    It("Should Not Inject Components By Default", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<AMockActorWithSubobjects>();
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        AMockActorWithSubobjects* Actor = Container->Resolve<AMockActorWithSubobjects>();
+
+        TestNotNull("Actor Reader", Actor->Reader.GetObject());
+        TestNull("Component Reader", Actor->Component->Reader.GetObject());
+        TestNull("Subobject Reader", Actor->Subobject->Reader.GetObject());
+    });
+
+    It("Should Inject Components Of Created Actor", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<AMockActorWithSubobjects>();
+        Builder.SetInjectSubobjects(EInjectSubobjects::Components);
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        AMockActorWithSubobjects* Actor = Container->Resolve<AMockActorWithSubobjects>();
+
+        TestEqual("Component Reader", Actor->Component->Reader.GetObject(), Actor->Reader.GetObject());
+        TestNull("Subobject Reader", Actor->Subobject->Reader.GetObject());
+    });
+
+    It("Should Inject Components Added By Construction Script Of Created Actor", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<AMockActorWithConstructedComponent>();
+        Builder.SetInjectSubobjects(EInjectSubobjects::Components);
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        AMockActorWithConstructedComponent* Actor = Container->Resolve<AMockActorWithConstructedComponent>();
+        if (TestNotNull("Constructed Component", Actor->ConstructedComponent.Get()))
+        {
+            TestEqual("Component Reader", Actor->ConstructedComponent->Reader.GetObject(), Actor->Reader.GetObject());
+        }
+
+        TArray<FTransform> Transforms;
+        Transforms.Emplace(FVector(100.f, 0.f, 0.f));
+
+        TArray<AMockActorWithConstructedComponent*> Actors = Container->ResolveActors<AMockActorWithConstructedComponent>(Transforms);
+        if (TestEqual("Actors Num", Actors.Num(), 1) && TestNotNull("Constructed Component of spawned actor", Actors[0]->ConstructedComponent.Get()))
+        {
+            TestNotNull("Component Reader of spawned actor", Actors[0]->ConstructedComponent->Reader.GetObject());
+        }
+    });
+
+    It("Should Inject Components Added At Runtime", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        AMockSceneActor* Actor = Helper.World->SpawnActor<AMockSceneActor>();
+        UMockReaderComponent* Component = NewObject<UMockReaderComponent>(Actor);
+        Component->RegisterComponent();
+
+        TestTrue("Injected", Container->Inject(Actor, EInjectSubobjects::Components));
+        TestNotNull("Component Reader", Component->Reader.GetObject());
+    });
+
+    It("Should Inject Default Subobjects When Requested", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        AMockActorWithSubobjects* Actor = Helper.World->SpawnActor<AMockActorWithSubobjects>();
+        Container->Inject(Actor, EInjectSubobjects::ComponentsAndDefaultSubobjects);
+
+        TestNotNull("Actor Reader", Actor->Reader.GetObject());
+        TestNotNull("Component Reader", Actor->Component->Reader.GetObject());
+        TestNotNull("Subobject Reader", Actor->Subobject->Reader.GetObject());
+    });
+
+    It("Should Inject Subobjects Nested In Subobjects Without Dependencies", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UMockObjectWithNestedSubobject* Object = NewObject<UMockObjectWithNestedSubobject>();
+
+        TestTrue("Injected", Container->Inject(Object, EInjectSubobjects::ComponentsAndDefaultSubobjects));
+        TestNotNull("Nested Subobject Reader", Object->Subobject->Nested->Reader.GetObject());
+    });
+
+    It("Should Inject Nested Subobjects Of Created Objects", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.SetInjectSubobjects(EInjectSubobjects::ComponentsAndDefaultSubobjects);
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UMockObjectWithNestedSubobject* Object = Container->Resolve<UMockObjectWithNestedSubobject>();
+
+        TestNotNull("Nested Subobject Reader", Object->Subobject->Nested->Reader.GetObject());
+    });
+
+    It("Should Use Parent Mode In Nested Container", [this]
+    {
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.SetInjectSubobjects(EInjectSubobjects::ComponentsAndDefaultSubobjects);
+        UObjectContainer* Parent = ParentBuilder.Build();
+
+        UObjectContainer* Nested = FObjectContainerBuilder().BuildNested(*Parent);
+
+        TestEqual("Mode", Nested->GetInjectSubobjects(), EInjectSubobjects::ComponentsAndDefaultSubobjects);
+    });
+}
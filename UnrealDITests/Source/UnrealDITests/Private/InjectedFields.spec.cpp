@@ -0,0 +1,56 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockClasses_InjectedFields.h"
+
+BEGIN_DEFINE_SPEC(FInjectedFieldsSpec, "UnrealDI.InjectedFields", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FInjectedFieldsSpec)
+
+void FInjectedFieldsSpec::Define()
+{
+    It("Should Inject Marked Fields When Resolved", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().AsSelf().SingleInstance();
+        Builder.RegisterType<UMockInjectedFields>();
+        UObjectContainer* Container = Builder.Build();
+
+        UMockInjectedFields* Object = Container->Resolve<UMockInjectedFields>();
+
+        TestEqual("Object field", Object->Reader.Get(), Container->Resolve<UMockReader>());
+        TestEqual("Interface field", Object->ReaderInterface.GetObject(), (UObject*)Container->Resolve<UMockReader>());
+        TestNotNull("Interface field pointer", Object->ReaderInterface.GetInterface());
+        TestNull("Field without Inject", Object->NotInjected.Get());
+    });
+
+    It("Should Inject Marked Fields Of Existing Object", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().AsSelf();
+        UObjectContainer* Container = Builder.Build();
+
+        UMockInjectedFields* Object = NewObject<UMockInjectedFields>();
+
+        TestTrue("CanInject", Container->CanInject(UMockInjectedFields::StaticClass()));
+        TestTrue("Injected", Container->Inject(Object));
+        TestNotNull("Object field", Object->Reader.Get());
+        TestNotNull("Interface field", Object->ReaderInterface.GetObject());
+    });
+
+    It("Should Inject Fields Before InitDependencies", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().AsSelf();
+        Builder.RegisterType<UMockInjectedFieldsWithInit>();
+        UObjectContainer* Container = Builder.Build();
+
+        UMockInjectedFieldsWithInit* Object = Container->Resolve<UMockInjectedFieldsWithInit>();
+
+        TestTrue("Inherited field injected before InitDependencies", Object->bReaderInjectedBeforeInit);
+    });
+}
@@ -0,0 +1,179 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+#include "DI/ObjectsCollection.h"
+#include "DI/ObjectsMap.h"
+
+#include "MockClasses.h"
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FKeyedSpec, "UnrealDI.Keyed", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FKeyedSpec)
+
+void FKeyedSpec::Define()
+{
+    It("Should Resolve Registration By Key", [this]
+    {
+        UMockReader* Reader1 = NewObject<UMockReader>();
+        UMockReader* Reader2 = NewObject<UMockReader>();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance<UMockReader>(Reader1).As<IReader>().Keyed("First");
+        Builder.RegisterInstance<UMockReader>(Reader2).As<IReader>().Keyed("Second");
+        UObjectContainer* Container = Builder.Build();
+
+        TestEqual("First", Container->ResolveKeyed<IReader>("First").GetObject(), (UObject*)Reader1);
+        TestEqual("Second", Container->ResolveKeyed<IReader>("Second").GetObject(), (UObject*)Reader2);
+    });
+
+    It("Should Create Only Requested Implementation", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().Keyed("First");
+        Builder.RegisterType<UMockReader>().As<IReader>().Keyed("Second");
+        UObjectContainer* Container = Builder.Build();
+
+        TArray<UObject*> ReadersBefore;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersBefore);
+
+        Container->ResolveKeyed<IReader>("Second");
+
+        TArray<UObject*> ReadersAfter;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersAfter);
+
+        TestEqual("Created objects Num", ReadersAfter.Num() - ReadersBefore.Num(), 1);
+    });
+
+    It("Should Return Null From TryResolveKeyed For Unknown Key", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().Keyed("First");
+        UObjectContainer* Container = Builder.Build();
+
+        TestNull("Resolved", Container->TryResolveKeyed<IReader>("Unknown").GetObject());
+    });
+
+    It("Should Not Resolve Keyed Registration Without Key", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().Keyed("First");
+        UObjectContainer* Container = Builder.Build();
+
+        TestNull("Resolved", Container->TryResolve<IReader>().GetObject());
+        TestEqual("ResolveAll Num", Container->TryResolveAll<IReader>().Num(), 0);
+    });
+
+    It("Should Resolve Keyed Registration From Parent Container", [this]
+    {
+        UMockReader* Reader = NewObject<UMockReader>();
+
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterInstance<UMockReader>(Reader).As<IReader>().Keyed("First");
+        UObjectContainer* Parent = ParentBuilder.Build();
+
+        UObjectContainer* Nested = FObjectContainerBuilder().BuildNested(*Parent);
+
+        TestEqual("Resolved", Nested->ResolveKeyed<IReader>("First").GetObject(), (UObject*)Reader);
+    });
+
+    It("Should Resolve Map Of Keyed Registrations", [this]
+    {
+        UMockReader* Reader1 = NewObject<UMockReader>();
+        UMockReader* Reader2 = NewObject<UMockReader>();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance<UMockReader>(Reader1).As<IReader>().Keyed("First");
+        Builder.RegisterInstance<UMockReader>(Reader2).As<IReader>().Keyed("Second");
+        UObjectContainer* Container = Builder.Build();
+
+        TObjectsMap<FName, IReader> Map = Container->ResolveMap<IReader>();
+
+        TestEqual("Num", Map.Num(), 2);
+        TestEqual("First", Map.FindChecked("First").GetObject(), (UObject*)Reader1);
+        TestEqual("Second", Map.FindChecked("Second").GetObject(), (UObject*)Reader2);
+        TestNull("Unknown", Map.Find("Unknown").GetObject());
+    });
+
+    It("Should Create Map Entries Lazily", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().Keyed("First").SingleInstance();
+        Builder.RegisterType<UMockReader>().As<IReader>().Keyed("Second").SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        TArray<UObject*> ReadersBefore;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersBefore);
+
+        TObjectsMap<FName, IReader> Map = Container->ResolveMap<IReader>();
+        UObject* First = Map.FindChecked("First").GetObject();
+
+        TArray<UObject*> ReadersAfter;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersAfter);
+
+        TestEqual("Created objects Num", ReadersAfter.Num() - ReadersBefore.Num(), 1);
+        TestEqual("Same object on second Find", Map.FindChecked("First").GetObject(), First);
+    });
+
+    It("Should Create Transient Map Entry On Each Find", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().Keyed("First");
+        UObjectContainer* Container = Builder.Build();
+
+        TObjectsMap<FName, IReader> Map = Container->ResolveMap<IReader>();
+
+        TestNotEqual("Same object on second Find", Map.FindChecked("First").GetObject(), Map.FindChecked("First").GetObject());
+    });
+
+    It("Should Return Recreated Entry From Resolved Map After Replace", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UNeedInterfaceInstance>().Keyed("First").SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        TObjectsMap<FName, UNeedInterfaceInstance> Map = Container->ResolveMap<UNeedInterfaceInstance>();
+        UNeedInterfaceInstance* Before = Map.FindChecked("First");
+
+        Container->ReplaceRegistration<IReader, UMockResettableReader>();
+        UNeedInterfaceInstance* After = Map.FindChecked("First");
+
+        TestNotEqual("Same object after replace", After, Before);
+        TestTrue("Received new implementation", After->Instance.GetObject()->IsA<UMockResettableReader>());
+    });
+
+    It("Should Include Keys From Parent Container In Map", [this]
+    {
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterType<UMockReader>().As<IReader>().Keyed("First");
+        UObjectContainer* Parent = ParentBuilder.Build();
+
+        FObjectContainerBuilder NestedBuilder;
+        NestedBuilder.RegisterType<UMockReader>().As<IReader>().Keyed("First");
+        NestedBuilder.RegisterType<UMockReader>().As<IReader>().Keyed("Second");
+        UObjectContainer* Nested = NestedBuilder.BuildNested(*Parent);
+
+        TObjectsMap<FName, IReader> Map = Nested->ResolveMap<IReader>();
+
+        TestEqual("Num", Map.Num(), 2);
+        TestTrue("Contains First", Map.Contains("First"));
+        TestTrue("Contains Second", Map.Contains("Second"));
+    });
+
+    It("Should Inject Map Into InitDependencies", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().Keyed("First");
+        UObjectContainer* Container = Builder.Build();
+
+        Container->InvokeWithDependencies([this](TObjectsMap<FName, IReader>&& Map)
+        {
+            TestEqual("Num", Map.Num(), 1);
+            TestNotNull("First", Map.Find("First").GetObject());
+        });
+    });
+}
@@ -180,6 +180,143 @@ void LifetimesSpec::Define()
         });
     });
 
+    Describe("KeepAliveSingleInstance", [this]()
+    {
+        It("Should Resolve Same Object", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().KeepAliveSingleInstance(60.0);
+            UObjectContainer* Container = Builder.Build();
+
+            UMockReader* Reader1 = Container->Resolve<UMockReader>();
+            UMockReader* Reader2 = Container->Resolve<UMockReader>();
+
+            TestEqual("Resolve returned different objects", Reader1, Reader2);
+        });
+
+        It("Should Survive GC Within Keep Alive Limit", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().KeepAliveSingleInstance(0.0, 2);
+            UObjectContainer* Container = Builder.Build();
+            Container->AddToRoot();
+
+            TWeakObjectPtr<UMockReader> Reader1 = Container->Resolve<UMockReader>();
+
+            ADD_LATENT_AUTOMATION_COMMAND(FRunGC);
+            ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Container, Reader1]()
+            {
+                TestNotNull("Instance was collected", Reader1.Get());
+                TestEqual("Resolve returned different objects", Container->Resolve<UMockReader>(), Reader1.Get());
+                Container->RemoveFromRoot();
+                return true;
+            }));
+        });
+
+        It("Should Not Survive GC After Keep Alive Limit", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().KeepAliveSingleInstance(0.0, 1);
+            UObjectContainer* Container = Builder.Build();
+            Container->AddToRoot();
+
+            TWeakObjectPtr<UMockReader> Reader1 = Container->Resolve<UMockReader>();
+
+            ADD_LATENT_AUTOMATION_COMMAND(FRunGC);
+            ADD_LATENT_AUTOMATION_COMMAND(FRunGC);
+            ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Container, Reader1]()
+            {
+                TestNull("Instance was not collected", Reader1.Get());
+                Container->RemoveFromRoot();
+                return true;
+            }));
+        });
+
+        It("Should Not Count Reference Collection As GC", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().KeepAliveSingleInstance(0.0, 1);
+            UObjectContainer* Container = Builder.Build();
+            Container->AddToRoot();
+
+            TWeakObjectPtr<UMockReader> Reader1 = Container->Resolve<UMockReader>();
+
+            // e.g. reference viewer walks references the same way GC does
+            for (int32 i = 0; i < 3; ++i)
+            {
+                TArray<UObject*> References;
+                FReferenceFinder ReferenceFinder(References);
+                ReferenceFinder.FindReferences(Container);
+            }
+
+            ADD_LATENT_AUTOMATION_COMMAND(FRunGC);
+            ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Container, Reader1]()
+            {
+                TestNotNull("Instance was collected", Reader1.Get());
+                Container->RemoveFromRoot();
+                return true;
+            }));
+        });
+
+        It("Should Count Each GC Within One Frame", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().KeepAliveSingleInstance(0.0, 1);
+            UObjectContainer* Container = Builder.Build();
+            Container->AddToRoot();
+
+            TWeakObjectPtr<UMockReader> Reader1 = Container->Resolve<UMockReader>();
+
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            TestNotNull("Instance was collected by first GC", Reader1.Get());
+
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            TestNull("Instance was not collected by second GC", Reader1.Get());
+
+            Container->RemoveFromRoot();
+        });
+
+        It("Should Not Renew Keep Alive When Container Is Rebound", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().KeepAliveSingleInstance(0.0, 2);
+            UObjectContainer* Container = Builder.Build();
+            Container->AddToRoot();
+
+            TWeakObjectPtr<UMockReader> Reader1 = Container->Resolve<UMockReader>();
+
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+            // rebind only inspects kept instances, it must not count as a resolve
+            Container->Rebind(NewObject<UMockReader>());
+
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            TestNull("Instance was not collected", Reader1.Get());
+
+            Container->RemoveFromRoot();
+        });
+
+        It("Should Not Survive GC After Memory Trim", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().KeepAliveSingleInstance(60.0);
+            UObjectContainer* Container = Builder.Build();
+            Container->AddToRoot();
+
+            TWeakObjectPtr<UMockReader> Reader1 = Container->Resolve<UMockReader>();
+            FCoreDelegates::GetMemoryTrimDelegate().Broadcast();
+
+            ADD_LATENT_AUTOMATION_COMMAND(FRunGC);
+            ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Container, Reader1]()
+            {
+                TestNull("Instance was not collected", Reader1.Get());
+                Container->RemoveFromRoot();
+                return true;
+            }));
+        });
+    });
+
     Describe("Instance", [this]()
     {
         It("Should Resolve", [this]()
@@ -230,4 +367,48 @@ void LifetimesSpec::Define()
             }));
         });
     });
+
+    Describe("PerFrame", [this]()
+    {
+        It("Should Resolve Same Object Within Frame", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().PerFrame();
+            UObjectContainer* Container = Builder.Build();
+
+            UMockReader* Reader1 = Container->Resolve<UMockReader>();
+            UMockReader* Reader2 = Container->Resolve<UMockReader>();
+
+            TestEqual("Resolve returned different objects", Reader1, Reader2);
+        });
+
+        It("Should Resolve New Object On Next Frame", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().PerFrame();
+            UObjectContainer* Container = Builder.Build();
+
+            UMockReader* Reader1 = Container->Resolve<UMockReader>();
+            ++GFrameCounter;
+            UMockReader* Reader2 = Container->Resolve<UMockReader>();
+
+            TestNotEqual("Resolve returned same objects", Reader1, Reader2);
+        });
+
+        It("Should Reset And Reuse Resettable Object On Next Frame", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockResettableReader>().PerFrame();
+            UObjectContainer* Container = Builder.Build();
+
+            UMockResettableReader* Reader1 = Container->Resolve<UMockResettableReader>();
+            ++GFrameCounter;
+            UMockResettableReader* Reader2 = Container->Resolve<UMockResettableReader>();
+            UMockResettableReader* Reader3 = Container->Resolve<UMockResettableReader>();
+
+            TestEqual("Resolve returned different objects", Reader1, Reader2);
+            TestEqual("Resolve returned different objects", Reader2, Reader3);
+            TestEqual("Reset Count", Reader1->ResetCount, 1);
+        });
+    });
 }
\ No newline at end of file
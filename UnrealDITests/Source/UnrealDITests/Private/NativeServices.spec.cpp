@@ -0,0 +1,175 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockReader.h"
+
+namespace NativeServicesSpec
+{
+    class INativeGreeter
+    {
+    public:
+        virtual ~INativeGreeter() = default;
+        virtual FString Greet() const = 0;
+    };
+
+    class FNativeGreeter : public INativeGreeter
+    {
+    public:
+        FString Greet() const override { return TEXT("Hello"); }
+    };
+
+    /* Requests native service and UObject */
+    class FNativeConsumer
+    {
+    public:
+        void InitDependencies(TSharedRef<INativeGreeter> InGreeter, UMockReader* InReader)
+        {
+            Greeter = InGreeter;
+            Reader = InReader;
+        }
+
+        TSharedPtr<INativeGreeter> Greeter;
+        UMockReader* Reader = nullptr;
+    };
+
+    /* Requests optional native service */
+    class FOptionalNativeConsumer
+    {
+    public:
+        void InitDependencies(TSharedPtr<INativeGreeter> InGreeter)
+        {
+            Greeter = InGreeter;
+            bInitialized = true;
+        }
+
+        TSharedPtr<INativeGreeter> Greeter;
+        bool bInitialized = false;
+    };
+
+    /* Two types whose names differ only by case */
+    class FCaseSensitive
+    {
+    public:
+        int32 Value = 1;
+    };
+
+    class FCASESENSITIVE
+    {
+    public:
+        int32 Value = 2;
+    };
+}
+
+using namespace NativeServicesSpec;
+
+BEGIN_DEFINE_SPEC(FNativeServicesSpec, "UnrealDI.NativeServices", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FNativeServicesSpec)
+
+void FNativeServicesSpec::Define()
+{
+    It("Should Resolve Native Service By Interface", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterNative<INativeGreeter, FNativeGreeter>();
+        UObjectContainer* Container = Builder.Build();
+
+        TSharedRef<INativeGreeter> Greeter = Container->ResolveNative<INativeGreeter>();
+
+        TestEqual("Greet", Greeter->Greet(), FString(TEXT("Hello")));
+    });
+
+    It("Should Resolve New Objects For Transient", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterNative<INativeGreeter, FNativeGreeter>();
+        UObjectContainer* Container = Builder.Build();
+
+        TSharedRef<INativeGreeter> Greeter1 = Container->ResolveNative<INativeGreeter>();
+        TSharedRef<INativeGreeter> Greeter2 = Container->ResolveNative<INativeGreeter>();
+
+        TestNotEqual("Resolve returned same objects", &Greeter1.Get(), &Greeter2.Get());
+    });
+
+    It("Should Resolve Same Object For SingleInstance", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterNative<INativeGreeter, FNativeGreeter>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        TSharedRef<INativeGreeter> Greeter1 = Container->ResolveNative<INativeGreeter>();
+        TSharedRef<INativeGreeter> Greeter2 = Container->ResolveNative<INativeGreeter>();
+
+        TestEqual("Resolve returned different objects", &Greeter1.Get(), &Greeter2.Get());
+    });
+
+    It("Should Return Null From TryResolveNative If Not Registered", [this]
+    {
+        UObjectContainer* Container = FObjectContainerBuilder().Build();
+
+        TestFalse("Resolved", Container->TryResolveNative<INativeGreeter>().IsValid());
+    });
+
+    It("Should Inject Native And UObject Dependencies Into Native Service", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterNative<INativeGreeter, FNativeGreeter>();
+        Builder.RegisterNative<FNativeConsumer>();
+        Builder.RegisterType<UMockReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        TSharedRef<FNativeConsumer> Consumer = Container->ResolveNative<FNativeConsumer>();
+
+        TestTrue("Greeter injected", Consumer->Greeter.IsValid());
+        TestNotNull("Reader injected", Consumer->Reader);
+    });
+
+    It("Should Inject Null TSharedPtr If Not Registered", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterNative<FOptionalNativeConsumer>();
+        UObjectContainer* Container = Builder.Build();
+
+        TSharedRef<FOptionalNativeConsumer> Consumer = Container->ResolveNative<FOptionalNativeConsumer>();
+
+        TestTrue("InitDependencies called", Consumer->bInitialized);
+        TestFalse("Greeter injected", Consumer->Greeter.IsValid());
+    });
+
+    It("Should Not Mix Types Differing Only By Case", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterNative<FCaseSensitive>();
+        UObjectContainer* Container = Builder.Build();
+
+        TestTrue("Registered type resolved", Container->TryResolveNative<FCaseSensitive>().IsValid());
+        TestFalse("Other type resolved", Container->TryResolveNative<FCASESENSITIVE>().IsValid());
+    });
+
+    It("Should Resolve From Parent Container", [this]
+    {
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterNative<INativeGreeter, FNativeGreeter>().SingleInstance();
+        UObjectContainer* Parent = ParentBuilder.Build();
+
+        UObjectContainer* Nested = FObjectContainerBuilder().BuildNested(*Parent);
+
+        TestEqual("Resolved same object", &Nested->ResolveNative<INativeGreeter>().Get(), &Parent->ResolveNative<INativeGreeter>().Get());
+    });
+
+    It("Should Invoke With Native Dependencies", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterNative<INativeGreeter, FNativeGreeter>();
+        UObjectContainer* Container = Builder.Build();
+
+        Container->InvokeWithDependencies([this](TSharedRef<INativeGreeter> Greeter)
+        {
+            TestEqual("Greet", Greeter->Greet(), FString(TEXT("Hello")));
+        });
+    });
+}
@@ -0,0 +1,102 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FPreparedInvocationSpec, "UnrealDI.Prepared Invocation", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FPreparedInvocationSpec)
+
+void FPreparedInvocationSpec::Define()
+{
+    It("Should inject same SingleInstance on each call", [this]()
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UObject* First = nullptr;
+        UObject* Second = nullptr;
+
+        auto Invocation = Container->PrepareInvocation([&First](TScriptInterface<IReader>&& Reader) { First = Reader.GetObject(); });
+        Invocation();
+
+        Container->PrepareInvocation([&Second](TScriptInterface<IReader>&& Reader) { Second = Reader.GetObject(); })();
+
+        TestNotNull("Injected Interface", First);
+        TestEqual("Injected same object", First, Container->Resolve<IReader>().GetObject());
+        TestEqual("Injected same object in another invocation", Second, First);
+    });
+
+    It("Should create Transient arguments on each call", [this]()
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        TArray<UMockReader*> Injected;
+        auto Invocation = Container->PrepareInvocation([&Injected](UMockReader* Reader) { Injected.Add(Reader); });
+
+        Invocation();
+        Invocation();
+
+        if (TestEqual("Calls Num", Injected.Num(), 2))
+        {
+            TestNotNull("Injected Object", Injected[0]);
+            TestNotEqual("Injected same object", Injected[0], Injected[1]);
+        }
+    });
+
+    It("Should pass runtime arguments before injected ones", [this]()
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        auto Invocation = Container->PrepareInvocation<float, int32>([](float DeltaTime, int32 Frame, TObjectPtr<UMockReader> Reader)
+        {
+            return Reader != nullptr ? DeltaTime * Frame : 0.f;
+        });
+
+        TestEqual("Result", Invocation(0.5f, 4), 2.f);
+    });
+
+    It("Should inject new instance after SingleInstance is released", [this]()
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UObject* Injected = nullptr;
+        auto Invocation = Container->PrepareInvocation([&Injected](TScriptInterface<IReader>&& Reader) { Injected = Reader.GetObject(); });
+
+        Invocation();
+        Container->ReplaceRegistration<IReader, UMockResettableReader>();
+        Invocation();
+
+        TestTrue("Injected new implementation", Injected != nullptr && Injected->IsA<UMockResettableReader>());
+        TestEqual("Injected same object as Resolve", Injected, Container->Resolve<IReader>().GetObject());
+    });
+
+    It("Should invoke mutable lambda", [this]()
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        TArray<int32> Calls;
+        auto Invocation = Container->PrepareInvocation([&Calls, Counter = 0](UMockReader* Reader) mutable { Calls.Add(++Counter); });
+
+        Invocation();
+        Invocation();
+
+        if (TestEqual("Calls Num", Calls.Num(), 2))
+        {
+            TestEqual("Lambda state is kept between calls", Calls[1], 2);
+        }
+    });
+}
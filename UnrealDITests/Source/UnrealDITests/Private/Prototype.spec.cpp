@@ -0,0 +1,128 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockClasses_Prototype.h"
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FPrototypeSpec, "UnrealDI.Prototype", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FPrototypeSpec)
+
+void FPrototypeSpec::Define()
+{
+    It("Should Resolve New Objects", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UPrototypeMock>().Prototype();
+        UObjectContainer* Container = Builder.Build();
+
+        UPrototypeMock* Object1 = Container->Resolve<UPrototypeMock>();
+        UPrototypeMock* Object2 = Container->Resolve<UPrototypeMock>();
+
+        TestNotEqual("Resolve returned same objects", Object1, Object2);
+        TestEqual("Outer", Object2->GetOuter(), Object1->GetOuter());
+    });
+
+    It("Should Copy Injected State Without Calling InitDependencies", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UPrototypeMock>().Prototype();
+        UObjectContainer* Container = Builder.Build();
+
+        UPrototypeMock* Object1 = Container->Resolve<UPrototypeMock>();
+        UPrototypeMock* Object2 = Container->Resolve<UPrototypeMock>();
+
+        TestEqual("Reader", Object2->Reader.GetObject(), Object1->Reader.GetObject());
+        TestEqual("LookupTable", Object2->LookupTable, Object1->LookupTable);
+        TestEqual("InitDependencies calls", Object2->InitCount, 1);
+    });
+
+    It("Should Resolve Transient Dependencies Again For Each Copy", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        Builder.RegisterType<UPrototypeMock>().Prototype();
+        UObjectContainer* Container = Builder.Build();
+
+        UPrototypeMock* Object1 = Container->Resolve<UPrototypeMock>();
+        UPrototypeMock* Object2 = Container->Resolve<UPrototypeMock>();
+        UPrototypeMock* Object3 = Container->Resolve<UPrototypeMock>();
+
+        TestNotNull("Reader", Object2->Reader.GetObject());
+        TestNotEqual("Reader of first copy", Object2->Reader.GetObject(), Object1->Reader.GetObject());
+        TestNotEqual("Reader of second copy", Object3->Reader.GetObject(), Object2->Reader.GetObject());
+        TestEqual("LookupTable", Object2->LookupTable, Object1->LookupTable);
+    });
+
+    It("Should Resolve PerFrame Dependencies Again For Each Copy", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().PerFrame();
+        Builder.RegisterType<UPrototypeMock>().Prototype();
+        UObjectContainer* Container = Builder.Build();
+
+        UPrototypeMock* Object1 = Container->Resolve<UPrototypeMock>();
+        ++GFrameCounter;
+        UPrototypeMock* Object2 = Container->Resolve<UPrototypeMock>();
+
+        TestNotEqual("Reader", Object2->Reader.GetObject(), Object1->Reader.GetObject());
+        TestEqual("Reader of current frame", Object2->Reader.GetObject(), Container->Resolve<IReader>().GetObject());
+    });
+
+    It("Should Not Copy Changes Made To First Instance", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UPrototypeMock>().Prototype();
+        UObjectContainer* Container = Builder.Build();
+
+        UPrototypeMock* Object1 = Container->Resolve<UPrototypeMock>();
+        Object1->LookupTable.Reset();
+
+        UPrototypeMock* Object2 = Container->Resolve<UPrototypeMock>();
+
+        TestEqual("LookupTable Num", Object2->LookupTable.Num(), 256);
+    });
+}
+
+BEGIN_DEFINE_SPEC(FPrototypeBenchmarkSpec, "UnrealDI.Benchmark.Prototype", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::PerfFilter)
+    template <typename T>
+    double MeasureResolves(UObjectContainer& Container, int32 Count)
+    {
+        // first resolve creates template for Prototype, don't count it
+        Container.Resolve<T>();
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Container.Resolve<T>();
+        }
+
+        return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+    }
+END_DEFINE_SPEC(FPrototypeBenchmarkSpec)
+
+void FPrototypeBenchmarkSpec::Define()
+{
+    It("Should Compare Prototype And Transient Resolves", [this]
+    {
+        constexpr int32 Count = 10000;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UTransientMock>();
+        Builder.RegisterType<UPrototypeMock>().Prototype();
+        UObjectContainer* Container = Builder.Build();
+
+        const double TransientMs = MeasureResolves<UTransientMock>(*Container, Count);
+        const double PrototypeMs = MeasureResolves<UPrototypeMock>(*Container, Count);
+
+        AddInfo(FString::Printf(TEXT("%d resolves: Transient %.2f ms, Prototype %.2f ms (x%.2f)"), Count, TransientMs, PrototypeMs, PrototypeMs > 0.0 ? TransientMs / PrototypeMs : 0.0));
+    });
+}
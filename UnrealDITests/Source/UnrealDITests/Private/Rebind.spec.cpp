@@ -0,0 +1,109 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+#include "DI/InjectOnConstruction.h"
+
+#include "MockClasses.h"
+#include "MockReader.h"
+#include "MockSubsystem.h"
+#include "TempWorldHelper.h"
+
+BEGIN_DEFINE_SPEC(FRebindSpec, "UnrealDI.Rebind", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FRebindSpec)
+
+void FRebindSpec::Define()
+{
+    It("Should Create World Bound Instances In New World", [this]
+    {
+        FTempWorldHelper OldWorld;
+        FTempWorldHelper NewWorld;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build(OldWorld.World);
+
+        UMockReader* OldReader = Container->Resolve<UMockReader>();
+
+        Container->Rebind(NewWorld.World);
+
+        UMockReader* NewReader = Container->Resolve<UMockReader>();
+        TestNotEqual("Resolved same object", NewReader, OldReader);
+        TestTrue("Created in new World", NewReader->IsIn(NewWorld.World));
+        TestTrue("Container moved to new World", Container->IsIn(NewWorld.World));
+    });
+
+    It("Should Keep Instances Not Bound To World", [this]
+    {
+        FTempWorldHelper OldWorld;
+        FTempWorldHelper NewWorld;
+
+        FObjectContainerBuilder Builder;
+        Builder.SetOuterForNewObjects(NewObject<UTestOuter>());
+        Builder.RegisterType<UMockReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build(OldWorld.World);
+
+        UMockReader* Reader = Container->Resolve<UMockReader>();
+
+        Container->Rebind(NewWorld.World);
+
+        TestEqual("Resolved same object", Container->Resolve<UMockReader>(), Reader);
+    });
+
+    It("Should Create Instances Depending On World Bound Ones Again", [this]
+    {
+        FTempWorldHelper OldWorld;
+        FTempWorldHelper NewWorld;
+
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterType<UMockReader>().SingleInstance();
+        UObjectContainer* Parent = ParentBuilder.Build(OldWorld.World);
+
+        FObjectContainerBuilder NestedBuilder;
+        NestedBuilder.SetOuterForNewObjects(NewObject<UTestOuter>());
+        NestedBuilder.RegisterType<UNeedObjectInstance>().SingleInstance();
+        UObjectContainer* Nested = NestedBuilder.BuildNested(*Parent);
+
+        UNeedObjectInstance* OldDependent = Nested->Resolve<UNeedObjectInstance>();
+
+        Parent->Rebind(NewWorld.World);
+
+        UNeedObjectInstance* NewDependent = Nested->Resolve<UNeedObjectInstance>();
+        TestNotEqual("Dependent was recreated", NewDependent, OldDependent);
+        TestEqual("Dependent received new instance", NewDependent->Instance, Parent->Resolve<UMockReader>());
+    });
+
+    It("Should Resolve Subsystem Of New World", [this]
+    {
+        FTempWorldHelper OldWorld;
+        FTempWorldHelper NewWorld;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterSubsystem<UMockWorldSubsystem>();
+        UObjectContainer* Container = Builder.Build(OldWorld.World);
+
+        Container->Resolve<UMockWorldSubsystem>();
+        Container->Rebind(NewWorld.World);
+
+        TestEqual("Resolved subsystem of new World", Container->Resolve<UMockWorldSubsystem>(), NewWorld.World->GetSubsystem<UMockWorldSubsystem>());
+    });
+
+    It("Should Move Container Assigned To World", [this]
+    {
+        FTempWorldHelper OldWorld;
+        FTempWorldHelper NewWorld;
+
+        UObjectContainer* Container = FObjectContainerBuilder().Build(OldWorld.World);
+        FInjectOnConstruction::SetContainerForWorld(OldWorld.World, Container);
+
+        Container->Rebind(NewWorld.World);
+
+        TestNull("Container of old World", FInjectOnConstruction::GetContainerForWorld(OldWorld.World));
+        TestEqual("Container of new World", FInjectOnConstruction::GetContainerForWorld(NewWorld.World), Container);
+
+        FInjectOnConstruction::ClearContainerForWorld(NewWorld.World);
+    });
+}
@@ -0,0 +1,145 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockClasses.h"
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FReplaceRegistrationSpec, "UnrealDI.ReplaceRegistration", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FReplaceRegistrationSpec)
+
+void FReplaceRegistrationSpec::Define()
+{
+    It("Should Resolve New Implementation", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        TestTrue("Replaced", Container->ReplaceRegistration<IReader, UMockResettableReader>());
+
+        TScriptInterface<IReader> Reader = Container->Resolve<IReader>();
+        TestTrue("Resolved new implementation", Reader.GetObject()->IsA<UMockResettableReader>());
+    });
+
+    It("Should Release Replaced SingleInstance", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UObject* OldReader = Container->Resolve<IReader>().GetObject();
+
+        Container->ReplaceRegistration<IReader, UMockResettableReader>();
+
+        UObject* NewReader = Container->Resolve<IReader>().GetObject();
+        TestNotEqual("Resolved same object", NewReader, OldReader);
+        TestEqual("Resolved same object on next resolve", Container->Resolve<IReader>().GetObject(), NewReader);
+    });
+
+    It("Should Release Shared Instances Depending On Replaced Registration", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UNeedInterfaceInstance>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UNeedInterfaceInstance* OldDependent = Container->Resolve<UNeedInterfaceInstance>();
+
+        Container->ReplaceRegistration<IReader, UMockResettableReader>();
+
+        UNeedInterfaceInstance* NewDependent = Container->Resolve<UNeedInterfaceInstance>();
+        TestNotEqual("Dependent was recreated", NewDependent, OldDependent);
+        TestTrue("Dependent received new implementation", NewDependent->Instance.GetObject()->IsA<UMockResettableReader>());
+    });
+
+    It("Should Release Shared Instances Depending On Replaced Registration Through Transient", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UNeedInterfaceInstance>();
+        Builder.RegisterType<UNeedInterfaceInstanceFactory>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UNeedInterfaceInstanceFactory* OldDependent = Container->Resolve<UNeedInterfaceInstanceFactory>();
+
+        Container->ReplaceRegistration<IReader, UMockResettableReader>();
+
+        UNeedInterfaceInstanceFactory* NewDependent = Container->Resolve<UNeedInterfaceInstanceFactory>();
+        TestNotEqual("Dependent was recreated", NewDependent, OldDependent);
+        TestTrue("Dependent received new implementation", NewDependent->Instance->Instance.GetObject()->IsA<UMockResettableReader>());
+    });
+
+    It("Should Release Shared Instances Of Nested Container Depending On Replaced Registration", [this]
+    {
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* ParentContainer = ParentBuilder.Build();
+
+        FObjectContainerBuilder ChildBuilder;
+        ChildBuilder.RegisterType<UNeedInterfaceInstance>().SingleInstance();
+        UObjectContainer* ChildContainer = ChildBuilder.BuildNested(*ParentContainer);
+
+        UNeedInterfaceInstance* OldDependent = ChildContainer->Resolve<UNeedInterfaceInstance>();
+
+        ParentContainer->ReplaceRegistration<IReader, UMockResettableReader>();
+
+        UNeedInterfaceInstance* NewDependent = ChildContainer->Resolve<UNeedInterfaceInstance>();
+        TestNotEqual("Dependent was recreated", NewDependent, OldDependent);
+        TestTrue("Dependent received new implementation", NewDependent->Instance.GetObject()->IsA<UMockResettableReader>());
+    });
+
+    It("Should Keep Shared Instances Not Depending On Replaced Registration", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UTestOuter>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        Container->Resolve<IReader>();
+        UTestOuter* Unrelated = Container->Resolve<UTestOuter>();
+
+        Container->ReplaceRegistration<IReader, UMockResettableReader>();
+
+        TestEqual("Unrelated instance kept", Container->Resolve<UTestOuter>(), Unrelated);
+    });
+
+    It("Should Recreate Released Shared Instances If Requested", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UNeedInterfaceInstance>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        Container->Resolve<UNeedInterfaceInstance>();
+
+        TArray<UObject*> ReadersBefore;
+        GetObjectsOfClass(UMockResettableReader::StaticClass(), ReadersBefore);
+
+        Container->ReplaceRegistration<IReader, UMockResettableReader>(true);
+
+        TArray<UObject*> ReadersAfter;
+        GetObjectsOfClass(UMockResettableReader::StaticClass(), ReadersAfter);
+
+        TestEqual("Created objects Num", ReadersAfter.Num() - ReadersBefore.Num(), 1);
+        TestEqual("Dependent received recreated instance", Container->Resolve<UNeedInterfaceInstance>()->Instance.GetObject(), Container->Resolve<IReader>().GetObject());
+    });
+
+    It("Should Not Replace Instance Registration", [this]
+    {
+        UMockReader* Reader = NewObject<UMockReader>();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance<UMockReader>(Reader).As<IReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        AddExpectedError(TEXT("do not create instances"), EAutomationExpectedErrorFlags::Contains, 1);
+
+        TestFalse("Replaced", Container->ReplaceRegistration<IReader, UMockResettableReader>());
+        TestEqual("Resolved registered instance", Container->Resolve<IReader>().GetObject(), (UObject*)Reader);
+    });
+}
@@ -0,0 +1,83 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "TempWorldHelper.h"
+#include "MockClasses_Actors.h"
+
+BEGIN_DEFINE_SPEC(FResolveActorsSpec, "UnrealDI.ResolveActors", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FResolveActorsSpec)
+
+void FResolveActorsSpec::Define()
+{
+    It("Should Spawn Actor Per Transform", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<AMockSceneActor>();
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        TArray<FTransform> Transforms;
+        Transforms.Emplace(FVector(100.f, 0.f, 0.f));
+        Transforms.Emplace(FVector(0.f, 200.f, 0.f));
+        Transforms.Emplace(FVector(0.f, 0.f, 300.f));
+
+        TArray<AMockSceneActor*> Actors = Container->ResolveActors<AMockSceneActor>(Transforms);
+
+        if (TestEqual("Actors Num", Actors.Num(), Transforms.Num()))
+        {
+            for (int32 i = 0; i < Actors.Num(); ++i)
+            {
+                TestEqual("Actor World", Actors[i]->GetWorld(), Helper.World);
+                TestEqual("Actor Location", Actors[i]->GetActorLocation(), Transforms[i].GetLocation());
+                TestNotNull("Reader", Actors[i]->Reader.GetObject());
+            }
+        }
+    });
+
+    It("Should Place Actors Of Custom Factory Before Finalizing", [this]
+    {
+        FTempWorldHelper Helper;
+        UMockActorInstanceFactory* Factory = NewObject<UMockActorInstanceFactory>();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance(Factory).As<IInstanceFactory>();
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<AMockSceneActor>();
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        TArray<FTransform> Transforms;
+        Transforms.Emplace(FVector(100.f, 0.f, 0.f));
+        Transforms.Emplace(FVector(0.f, 200.f, 0.f));
+
+        TArray<AMockSceneActor*> Actors = Container->ResolveActors<AMockSceneActor>(Transforms);
+
+        if (TestEqual("Actors Num", Actors.Num(), Transforms.Num()) && TestEqual("Finalized Num", Factory->FinalizedLocations.Num(), Transforms.Num()))
+        {
+            for (int32 i = 0; i < Actors.Num(); ++i)
+            {
+                TestEqual("Location when finalized", Factory->FinalizedLocations[i], Transforms[i].GetLocation());
+                TestEqual("Actor Location", Actors[i]->GetActorLocation(), Transforms[i].GetLocation());
+                TestNotNull("Reader", Actors[i]->Reader.GetObject());
+            }
+        }
+    });
+
+    It("Should Return Empty Array For No Transforms", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<AMockSceneActor>();
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        TestEqual("Actors Num", Container->ResolveActors<AMockSceneActor>({}).Num(), 0);
+    });
+}
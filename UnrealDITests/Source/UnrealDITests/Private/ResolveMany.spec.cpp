@@ -0,0 +1,60 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "IBlueprintDependencyInterface.h"
+#include "MockClasses.h"
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FResolveManySpec, "UnrealDI.ResolveMany", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FResolveManySpec)
+
+void FResolveManySpec::Define()
+{
+    It("Should Resolve All Types In Order", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UNeedInterfaceInstance>();
+        UObjectContainer* Container = Builder.Build();
+
+        UClass* Types[] = { UReader::StaticClass(), UNeedInterfaceInstance::StaticClass() };
+        UObject* Objects[2];
+        Container->ResolveMany(Types, Objects);
+
+        TestEqual("Reader", Objects[0], Container->Resolve<IReader>().GetObject());
+        TestTrue("NeedInterfaceInstance", Objects[1] != nullptr && Objects[1]->IsA<UNeedInterfaceInstance>());
+    });
+
+    It("Should Resolve Typed Tuple", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        auto [Reader, NeedInterface] = Container->ResolveMany<IReader, UNeedInterfaceInstance>();
+
+        TestNotNull("Reader", Reader.GetObject());
+        TestNotNull("NeedInterfaceInstance", NeedInterface);
+    });
+
+    It("Should Report All Failed Types Together", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        UClass* Types[] = { UReader::StaticClass(), UMockReader::StaticClass(), UBlueprintDependencyInterface::StaticClass() };
+        UObject* Objects[3];
+        TArray<UClass*> FailedTypes = Container->TryResolveMany(Types, Objects);
+
+        TestEqual("Failed types", FailedTypes, TArray<UClass*>{ UReader::StaticClass(), UBlueprintDependencyInterface::StaticClass() });
+        TestNull("Reader", Objects[0]);
+        TestNotNull("MockReader", Objects[1]);
+        TestNull("BlueprintDependencyInterface", Objects[2]);
+    });
+}
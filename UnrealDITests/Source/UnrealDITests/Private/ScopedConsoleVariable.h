@@ -0,0 +1,29 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/IConsoleManager.h"
+
+/*
+ * Sets console variable for the duration of a test and restores its previous value afterwards
+ */
+class FScopedConsoleVariable
+{
+public:
+    FScopedConsoleVariable(const TCHAR* Name, const TCHAR* Value)
+        : Variable(IConsoleManager::Get().FindConsoleVariable(Name))
+    {
+        check(Variable);
+        OldValue = Variable->GetString();
+        Variable->Set(Value);
+    }
+
+    ~FScopedConsoleVariable()
+    {
+        Variable->Set(*OldValue);
+    }
+
+private:
+    IConsoleVariable* Variable;
+    FString OldValue;
+};
@@ -0,0 +1,120 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockClasses_Disposable.h"
+
+BEGIN_DEFINE_SPEC(FShutdownSpec, "UnrealDI.Shutdown", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FShutdownSpec)
+
+void FShutdownSpec::Define()
+{
+    It("Should Dispose Shared Instances In Reverse Creation Order", [this]
+    {
+        UMockDisposeLog* Log = NewObject<UMockDisposeLog>();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance<UMockDisposeLog>(Log);
+        Builder.RegisterType<UMockDisposableService>().SingleInstance();
+        Builder.RegisterType<UMockDisposableConsumer>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UMockDisposableConsumer* Consumer = Container->Resolve<UMockDisposableConsumer>();
+
+        Container->Shutdown();
+
+        if (TestEqual("Disposed Num", Log->Disposed.Num(), 2))
+        {
+            TestEqual("Consumer disposed first", Log->Disposed[0].Get(), (UObject*)Consumer);
+            TestEqual("Service disposed last", Log->Disposed[1].Get(), (UObject*)Consumer->Service);
+        }
+    });
+
+    It("Should Dispose Recreated Shared Instance Once", [this]
+    {
+        UMockDisposeLog* Log = NewObject<UMockDisposeLog>();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance<UMockDisposeLog>(Log);
+        Builder.RegisterType<UMockDisposableService>().SingleInstance();
+        Builder.RegisterType<UMockDisposableConsumer>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        // enough recreations to compact creation order at least once
+        UMockDisposableConsumer* Consumer = nullptr;
+        for (int32 Index = 0; Index < 40; ++Index)
+        {
+            Container->ReplaceRegistration<UMockDisposableConsumer, UMockDisposableConsumer>();
+            Consumer = Container->Resolve<UMockDisposableConsumer>();
+        }
+
+        Container->Shutdown();
+
+        if (TestEqual("Disposed Num", Log->Disposed.Num(), 2))
+        {
+            TestEqual("Last consumer disposed first", Log->Disposed[0].Get(), (UObject*)Consumer);
+            TestEqual("Service disposed last", Log->Disposed[1].Get(), (UObject*)Consumer->Service);
+        }
+    });
+
+    It("Should Not Dispose Registered Instances", [this]
+    {
+        UMockDisposeLog* Log = NewObject<UMockDisposeLog>();
+        UMockDisposableService* Service = NewObject<UMockDisposableService>();
+        Service->Log = Log;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance<UMockDisposableService>(Service);
+        UObjectContainer* Container = Builder.Build();
+
+        Container->Resolve<UMockDisposableService>();
+        Container->Shutdown();
+
+        TestEqual("Disposed Num", Log->Disposed.Num(), 0);
+        TestTrue("Instance is valid", IsValid(Service));
+    });
+
+    It("Should Mark Released Instances As Garbage If Requested", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance<UMockDisposeLog>(NewObject<UMockDisposeLog>());
+        Builder.RegisterType<UMockDisposableService>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UMockDisposableService* Service = Container->Resolve<UMockDisposableService>();
+
+        Container->Shutdown(true);
+
+        TestFalse("Instance is valid", IsValid(Service));
+    });
+
+    It("Should Shut Down Nested Containers", [this]
+    {
+        UMockDisposeLog* Log = NewObject<UMockDisposeLog>();
+
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterInstance<UMockDisposeLog>(Log);
+        ParentBuilder.RegisterType<UMockDisposableService>().SingleInstance();
+        UObjectContainer* Parent = ParentBuilder.Build();
+
+        FObjectContainerBuilder NestedBuilder;
+        NestedBuilder.RegisterType<UMockDisposableConsumer>().SingleInstance();
+        UObjectContainer* Nested = NestedBuilder.BuildNested(*Parent);
+
+        UMockDisposableConsumer* Consumer = Nested->Resolve<UMockDisposableConsumer>();
+
+        Parent->Shutdown();
+
+        TestTrue("Nested is shut down", Nested->IsShutDown());
+        TestFalse("Nested is valid", IsValid(Nested));
+
+        if (TestEqual("Disposed Num", Log->Disposed.Num(), 2))
+        {
+            TestEqual("Nested instance disposed first", Log->Disposed[0].Get(), (UObject*)Consumer);
+        }
+    });
+}
@@ -0,0 +1,58 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockClasses.h"
+#include "MockReader.h"
+#include "ScopedConsoleVariable.h"
+
+namespace SlowResolveSpec
+{
+    // every resolve takes longer than that
+    const TCHAR* TinyThresholdMs = TEXT("0.000001");
+}
+
+using namespace SlowResolveSpec;
+
+BEGIN_DEFINE_SPEC(FSlowResolveSpec, "UnrealDI.SlowResolve", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FSlowResolveSpec)
+
+void FSlowResolveSpec::Define()
+{
+    It("Should Log Whole Resolve Chain", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        Builder.RegisterType<UNeedInterfaceInstance>();
+        UObjectContainer* Container = Builder.Build();
+
+        FScopedConsoleVariable Threshold(TEXT("UnrealDI.SlowResolveThresholdMs"), TinyThresholdMs);
+
+        AddExpectedError(TEXT("Resolve of NeedInterfaceInstance [Transient] took"), EAutomationExpectedErrorFlags::Contains, 1);
+        AddExpectedError(TEXT("Resolve chain:"), EAutomationExpectedErrorFlags::Contains, 1);
+        AddExpectedError(TEXT("  NeedInterfaceInstance [Transient] factory:"), EAutomationExpectedErrorFlags::Contains, 1);
+        AddExpectedError(TEXT("    MockReader [Transient] factory:"), EAutomationExpectedErrorFlags::Contains, 1);
+
+        Container->Resolve<UNeedInterfaceInstance>();
+    });
+
+    It("Should Log Interface Of Existing Instance", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        Container->Resolve<IReader>();
+
+        FScopedConsoleVariable Threshold(TEXT("UnrealDI.SlowResolveThresholdMs"), TinyThresholdMs);
+
+        AddExpectedError(TEXT("Resolve of Reader [SingleInstance] took"), EAutomationExpectedErrorFlags::Contains, 1);
+        AddExpectedError(TEXT("  Reader [SingleInstance] existing instance"), EAutomationExpectedErrorFlags::Contains, 1);
+
+        Container->Resolve<IReader>();
+    });
+}
@@ -0,0 +1,44 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockSubsystem.h"
+#include "TempWorldHelper.h"
+
+BEGIN_DEFINE_SPEC(FSubsystemsSpec, "UnrealDI.Subsystems", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FSubsystemsSpec)
+
+void FSubsystemsSpec::Define()
+{
+    It("Should Resolve World Subsystem Of Outer", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterSubsystem<UMockWorldSubsystem>();
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        UMockWorldSubsystem* Resolved = Container->Resolve<UMockWorldSubsystem>();
+
+        TestNotNull("Resolved", Resolved);
+        TestEqual("Resolved subsystem of World", Resolved, Helper.World->GetSubsystem<UMockWorldSubsystem>());
+        TestEqual("Resolved same object", Container->Resolve<UMockWorldSubsystem>(), Resolved);
+    });
+
+    It("Should Resolve World Subsystem By Interface", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterSubsystem<UMockWorldSubsystem>().As<IReader>();
+        UObjectContainer* Container = Builder.Build(Helper.World);
+
+        TScriptInterface<IReader> Reader = Container->Resolve<IReader>();
+
+        TestEqual("Resolved subsystem of World", Reader.GetObject(), (UObject*)Helper.World->GetSubsystem<UMockWorldSubsystem>());
+    });
+}
@@ -0,0 +1,170 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockClasses.h"
+#include "MockReader.h"
+#include "ScopedConsoleVariable.h"
+
+namespace TransientChurnSpec
+{
+    /* Collects lines printed by console command */
+    class FLinesOutputDevice : public FOutputDevice
+    {
+    public:
+        void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override
+        {
+            Lines.Add(V);
+        }
+
+        /* Returns report row of given class split into columns, or empty array if there is no such row */
+        TArray<FString> FindRow(const FString& ClassName) const
+        {
+            for (const FString& Line : Lines)
+            {
+                TArray<FString> Columns;
+                Line.ParseIntoArrayWS(Columns);
+
+                if (Columns.Num() > 0 && Columns[0] == ClassName)
+                {
+                    return Columns;
+                }
+            }
+
+            return {};
+        }
+
+        TArray<FString> Lines;
+    };
+
+    void ExecuteCommand(const TCHAR* Name, FOutputDevice& Output)
+    {
+        IConsoleObject* Command = IConsoleManager::Get().FindConsoleObject(Name);
+        check(Command && Command->AsCommand());
+
+        Command->AsCommand()->Execute({}, nullptr, Output);
+    }
+
+    // Created column of report row
+    constexpr int32 CreatedColumn = 1;
+
+    // Avg lifetime column of report row
+    constexpr int32 LifetimeColumn = 3;
+}
+
+using namespace TransientChurnSpec;
+
+BEGIN_DEFINE_SPEC(FTransientChurnSpec, "UnrealDI.TransientChurn", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FTransientChurnSpec)
+
+void FTransientChurnSpec::Define()
+{
+    It("Should Count Created Transient Objects", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        FLinesOutputDevice Output;
+        FScopedConsoleVariable SampleRate(TEXT("UnrealDI.TransientChurnSampleRate"), TEXT("2"));
+        ExecuteCommand(TEXT("UnrealDI.ResetTransientChurn"), Output);
+
+        for (int32 i = 0; i < 5; ++i)
+        {
+            Container->Resolve<UMockReader>();
+        }
+
+        ExecuteCommand(TEXT("UnrealDI.ReportTransientChurn"), Output);
+
+        const TArray<FString> Row = Output.FindRow(TEXT("MockReader"));
+        if (TestTrue("Report has row", Row.Num() > LifetimeColumn))
+        {
+            TestEqual("Created", Row[CreatedColumn], FString(TEXT("5")));
+            TestEqual("Avg lifetime before GC", Row[LifetimeColumn], FString(TEXT("n/a")));
+        }
+    });
+
+    It("Should Measure Lifetime Of Sampled Objects", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        FLinesOutputDevice Output;
+        FScopedConsoleVariable SampleRate(TEXT("UnrealDI.TransientChurnSampleRate"), TEXT("2"));
+        ExecuteCommand(TEXT("UnrealDI.ResetTransientChurn"), Output);
+
+        for (int32 i = 0; i < 5; ++i)
+        {
+            Container->Resolve<UMockReader>();
+        }
+
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+        ExecuteCommand(TEXT("UnrealDI.ReportTransientChurn"), Output);
+
+        const TArray<FString> Row = Output.FindRow(TEXT("MockReader"));
+        if (TestTrue("Report has row", Row.Num() > LifetimeColumn))
+        {
+            TestNotEqual("Avg lifetime after GC", Row[LifetimeColumn], FString(TEXT("n/a")));
+        }
+    });
+
+    It("Should Not Count Shared Objects", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        FLinesOutputDevice Output;
+        FScopedConsoleVariable SampleRate(TEXT("UnrealDI.TransientChurnSampleRate"), TEXT("1"));
+        ExecuteCommand(TEXT("UnrealDI.ResetTransientChurn"), Output);
+
+        Container->Resolve<UMockReader>();
+
+        ExecuteCommand(TEXT("UnrealDI.ReportTransientChurn"), Output);
+
+        TestEqual("Report row", Output.FindRow(TEXT("MockReader")).Num(), 0);
+    });
+
+    It("Should Not Count Objects While Disabled", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        FLinesOutputDevice Output;
+        FScopedConsoleVariable SampleRate(TEXT("UnrealDI.TransientChurnSampleRate"), TEXT("0"));
+        ExecuteCommand(TEXT("UnrealDI.ResetTransientChurn"), Output);
+
+        Container->Resolve<UMockReader>();
+
+        ExecuteCommand(TEXT("UnrealDI.ReportTransientChurn"), Output);
+
+        TestEqual("Report row", Output.FindRow(TEXT("MockReader")).Num(), 0);
+    });
+
+    It("Should Clear Data On Reset", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        FLinesOutputDevice Output;
+        FScopedConsoleVariable SampleRate(TEXT("UnrealDI.TransientChurnSampleRate"), TEXT("1"));
+
+        Container->Resolve<UMockReader>();
+
+        ExecuteCommand(TEXT("UnrealDI.ResetTransientChurn"), Output);
+        ExecuteCommand(TEXT("UnrealDI.ReportTransientChurn"), Output);
+
+        TestEqual("Report row", Output.FindRow(TEXT("MockReader")).Num(), 0);
+        TestTrue("Report is empty", Output.Lines.ContainsByPredicate([](const FString& Line) { return Line.StartsWith(TEXT("No transient objects were created")); }));
+    });
+}
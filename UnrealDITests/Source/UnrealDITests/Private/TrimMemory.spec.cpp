@@ -0,0 +1,57 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+
+#include "MockClasses.h"
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FTrimMemorySpec, "UnrealDI.TrimMemory", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FTrimMemorySpec)
+
+void FTrimMemorySpec::Define()
+{
+    It("Should Release References To Reconstructible Instances", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().KeepAliveSingleInstance(60.0);
+        Builder.RegisterType<UNeedInterfaceInstance>().PerFrame();
+        UObjectContainer* Container = Builder.Build();
+
+        Container->Resolve<UNeedInterfaceInstance>();
+
+        const FObjectContainerTrimResult Result = Container->TrimMemory();
+
+        TestEqual("Released references", Result.NumReleasedReferences, 2);
+        TestTrue("Released bytes", Result.ReleasedReferencesBytes > 0);
+    });
+
+    It("Should Keep SingleInstance", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UMockReader* Reader = Container->Resolve<UMockReader>();
+
+        const FObjectContainerTrimResult Result = Container->TrimMemory();
+
+        TestEqual("Released references", Result.NumReleasedReferences, 0);
+        TestEqual("Resolved same object", Container->Resolve<UMockReader>(), Reader);
+    });
+
+    It("Should Release Each Instance Only Once", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().AsSelf().KeepAliveSingleInstance(60.0);
+        UObjectContainer* Container = Builder.Build();
+
+        Container->Resolve<UMockReader>();
+
+        TestEqual("Released references", Container->TrimMemory().NumReleasedReferences, 1);
+        TestEqual("Released references on second call", Container->TrimMemory().NumReleasedReferences, 0);
+    });
+}
@@ -0,0 +1,148 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+#include "DI/ObjectContainerWarmUpManifest.h"
+
+#include "MockClasses.h"
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FWarmUpSpec, "UnrealDI.WarmUp", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FWarmUpSpec)
+
+void FWarmUpSpec::Define()
+{
+    It("Should record resolved registrations in order", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UNeedInterfaceInstance>();
+        UObjectContainer* Container = Builder.Build();
+
+        Container->StartRecordingWarmUp();
+        Container->Resolve<UNeedInterfaceInstance>();
+        Container->Resolve<IReader>();
+
+        UObjectContainerWarmUpManifest* Manifest = NewObject<UObjectContainerWarmUpManifest>();
+        Container->StopRecordingWarmUp(*Manifest);
+
+        if (TestEqual("Entries Num", Manifest->Entries.Num(), 2))
+        {
+            TestEqual("First Entry Interface", Manifest->Entries[0].Interface.Get(), UNeedInterfaceInstance::StaticClass());
+            TestFalse("First Entry Shared", Manifest->Entries[0].bShared);
+
+            TestEqual("Second Entry Interface", Manifest->Entries[1].Interface.Get(), UReader::StaticClass());
+            TestEqual("Second Entry EffectiveClass", Manifest->Entries[1].EffectiveClass.Get(), UMockReader::StaticClass());
+            TestTrue("Second Entry Shared", Manifest->Entries[1].bShared);
+        }
+    });
+
+    It("Should not record after recording is stopped", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        UObjectContainerWarmUpManifest* Manifest = NewObject<UObjectContainerWarmUpManifest>();
+
+        Container->StartRecordingWarmUp();
+        Container->StopRecordingWarmUp(*Manifest);
+        Container->Resolve<IReader>();
+
+        TestEqual("Entries Num", Manifest->Entries.Num(), 0);
+    });
+
+    It("Should create shared instances listed in manifest", [this]
+    {
+        UObjectContainerWarmUpManifest* Manifest = NewObject<UObjectContainerWarmUpManifest>();
+        FObjectContainerWarmUpEntry& Entry = Manifest->Entries.Emplace_GetRef();
+        Entry.Interface = UReader::StaticClass();
+        Entry.EffectiveClass = UMockReader::StaticClass();
+        Entry.bShared = true;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        TArray<UObject*> ReadersBefore;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersBefore);
+
+        Container->WarmUp(*Manifest);
+
+        TArray<UObject*> ReadersAfter;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersAfter);
+
+        TestEqual("Created objects Num", ReadersAfter.Num() - ReadersBefore.Num(), 1);
+
+        TScriptInterface<IReader> Resolved = Container->Resolve<IReader>();
+        TestTrue("Resolved object was created by WarmUp", !ReadersBefore.Contains(Resolved.GetObject()) && ReadersAfter.Contains(Resolved.GetObject()));
+    });
+
+    It("Should create shared instances registered in parent container", [this]
+    {
+        UObjectContainerWarmUpManifest* Manifest = NewObject<UObjectContainerWarmUpManifest>();
+        FObjectContainerWarmUpEntry& Entry = Manifest->Entries.Emplace_GetRef();
+        Entry.Interface = UReader::StaticClass();
+        Entry.EffectiveClass = UMockReader::StaticClass();
+        Entry.bShared = true;
+
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Parent = ParentBuilder.Build();
+
+        UObjectContainer* Nested = FObjectContainerBuilder().BuildNested(*Parent);
+
+        TArray<UObject*> ReadersBefore;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersBefore);
+
+        Nested->WarmUp(*Manifest);
+
+        TArray<UObject*> ReadersAfter;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersAfter);
+
+        TestEqual("Created objects Num", ReadersAfter.Num() - ReadersBefore.Num(), 1);
+        TestTrue("Parent resolves object created by WarmUp", !ReadersBefore.Contains(Parent->Resolve<IReader>().GetObject()));
+    });
+
+    It("Should record each registration once", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        Container->StartRecordingWarmUp();
+        Container->Resolve<IReader>();
+        Container->Resolve<IReader>();
+
+        UObjectContainerWarmUpManifest* Manifest = NewObject<UObjectContainerWarmUpManifest>();
+        Container->StopRecordingWarmUp(*Manifest);
+
+        TestEqual("Entries Num", Manifest->Entries.Num(), 1);
+    });
+
+    It("Should not create transient instances listed in manifest", [this]
+    {
+        UObjectContainerWarmUpManifest* Manifest = NewObject<UObjectContainerWarmUpManifest>();
+        FObjectContainerWarmUpEntry& Entry = Manifest->Entries.Emplace_GetRef();
+        Entry.Interface = UReader::StaticClass();
+        Entry.EffectiveClass = UMockReader::StaticClass();
+        Entry.bShared = false;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        UObjectContainer* Container = Builder.Build();
+
+        TArray<UObject*> ReadersBefore;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersBefore);
+
+        Container->WarmUp(*Manifest);
+
+        TArray<UObject*> ReadersAfter;
+        GetObjectsOfClass(UMockReader::StaticClass(), ReadersAfter);
+
+        TestEqual("Created objects Num", ReadersAfter.Num(), ReadersBefore.Num());
+    });
+}
@@ -0,0 +1,162 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "DI/IInstanceFactory.h"
+#include "MockReader.h"
+#include "MockClasses_Actors.generated.h"
+
+/* Actor with scene root, so it can be placed in the world. Requests IReader */
+UCLASS()
+class UNREALDITESTS_API AMockSceneActor : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AMockSceneActor()
+    {
+        RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+    }
+
+    void InitDependencies(TScriptInterface<IReader>&& InReader)
+    {
+        Reader = MoveTemp(InReader);
+    }
+
+    UPROPERTY()
+    TScriptInterface<IReader> Reader;
+};
+
+/* Component that requests IReader, but does not inject itself */
+UCLASS()
+class UNREALDITESTS_API UMockReaderComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    void InitDependencies(TScriptInterface<IReader>&& InReader)
+    {
+        Reader = MoveTemp(InReader);
+    }
+
+    UPROPERTY()
+    TScriptInterface<IReader> Reader;
+};
+
+/* Subobject that requests IReader */
+UCLASS()
+class UNREALDITESTS_API UMockReaderSubobject : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    void InitDependencies(TScriptInterface<IReader>&& InReader)
+    {
+        Reader = MoveTemp(InReader);
+    }
+
+    UPROPERTY()
+    TScriptInterface<IReader> Reader;
+};
+
+/* Subobject without dependencies that owns injectable subobject */
+UCLASS()
+class UNREALDITESTS_API UMockNestingSubobject : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UMockNestingSubobject()
+    {
+        Nested = CreateDefaultSubobject<UMockReaderSubobject>(TEXT("Nested"));
+    }
+
+    UPROPERTY()
+    TObjectPtr<UMockReaderSubobject> Nested;
+};
+
+/* Object without dependencies whose injectable subobject is nested one level deeper */
+UCLASS()
+class UNREALDITESTS_API UMockObjectWithNestedSubobject : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UMockObjectWithNestedSubobject()
+    {
+        Subobject = CreateDefaultSubobject<UMockNestingSubobject>(TEXT("Subobject"));
+    }
+
+    UPROPERTY()
+    TObjectPtr<UMockNestingSubobject> Subobject;
+};
+
+/* Actor with injectable component and injectable default subobject */
+UCLASS()
+class UNREALDITESTS_API AMockActorWithSubobjects : public AMockSceneActor
+{
+    GENERATED_BODY()
+
+public:
+    AMockActorWithSubobjects()
+    {
+        Component = CreateDefaultSubobject<UMockReaderComponent>(TEXT("Component"));
+        Subobject = CreateDefaultSubobject<UMockReaderSubobject>(TEXT("Subobject"));
+    }
+
+    UPROPERTY()
+    TObjectPtr<UMockReaderComponent> Component;
+
+    UPROPERTY()
+    TObjectPtr<UMockReaderSubobject> Subobject;
+};
+
+/* Adds injectable component in construction script, like Blueprint actors do with components added in editor */
+UCLASS()
+class UNREALDITESTS_API AMockActorWithConstructedComponent : public AMockSceneActor
+{
+    GENERATED_BODY()
+
+public:
+    void OnConstruction(const FTransform& Transform) override
+    {
+        Super::OnConstruction(Transform);
+
+        ConstructedComponent = NewObject<UMockReaderComponent>(this, TEXT("ConstructedComponent"));
+        ConstructedComponent->RegisterComponent();
+    }
+
+    UPROPERTY()
+    TObjectPtr<UMockReaderComponent> ConstructedComponent;
+};
+
+/* Spawns deferred actors without knowing their transform, like most project specific factories do. Remembers where actors were when finalized */
+UCLASS(HideDropDown)
+class UNREALDITESTS_API UMockActorInstanceFactory : public UObject, public IInstanceFactory
+{
+    GENERATED_BODY()
+
+public:
+    bool IsClassSupported(UClass* EffectiveClass) const override
+    {
+        return EffectiveClass->IsChildOf<AMockSceneActor>();
+    }
+
+    UObject* Create(UObject* Outer, UClass* EffectiveClass) const override
+    {
+        return Outer->GetWorld()->SpawnActorDeferred<AActor>(EffectiveClass, FTransform::Identity);
+    }
+
+    void FinalizeCreation(UObject* Object) const override
+    {
+        AActor* Actor = CastChecked<AActor>(Object);
+        FinalizedLocations.Add(Actor->GetActorLocation());
+        Actor->FinishSpawning(FTransform::Identity);
+    }
+
+    mutable TArray<FVector> FinalizedLocations;
+};
@@ -0,0 +1,63 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/Object.h"
+#include "Tasks/Task.h"
+#include "MockReader.h"
+#include "MockClasses_AsyncInit.generated.h"
+
+/* Stays not ready until CompleteInit is called */
+UCLASS()
+class UNREALDITESTS_API UAsyncInitService : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UE::Tasks::FTask InitDependencies(TScriptInterface<IReader>&& InReader)
+    {
+        Reader = MoveTemp(InReader);
+
+        return UE::Tasks::Launch(UE_SOURCE_LOCATION, [] {}, UE::Tasks::Prerequisites(InitEvent));
+    }
+
+    void CompleteInit() { InitEvent.Trigger(); }
+
+    UPROPERTY()
+    TScriptInterface<IReader> Reader;
+
+    UE::Tasks::FTaskEvent InitEvent{ UE_SOURCE_LOCATION };
+};
+
+/* Has nothing to wait for itself, but depends on UAsyncInitService */
+UCLASS()
+class UNREALDITESTS_API UAsyncInitDependent : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UE::Tasks::FTask InitDependencies(UAsyncInitService* InService)
+    {
+        Service = InService;
+        return UE::Tasks::FTask();
+    }
+
+    UPROPERTY()
+    TObjectPtr<UAsyncInitService> Service;
+};
+
+/* Initializes synchronously, but depends on UAsyncInitService */
+UCLASS()
+class UNREALDITESTS_API USyncInitDependent : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    void InitDependencies(UAsyncInitService* InService)
+    {
+        Service = InService;
+    }
+
+    UPROPERTY()
+    TObjectPtr<UAsyncInitService> Service;
+};
@@ -0,0 +1,66 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/IDisposable.h"
+#include "MockClasses_Disposable.generated.h"
+
+/* Collects disposed objects in order of disposal */
+UCLASS()
+class UNREALDITESTS_API UMockDisposeLog : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TArray<TObjectPtr<UObject>> Disposed;
+};
+
+/* Writes itself into dispose log when disposed */
+UCLASS()
+class UNREALDITESTS_API UMockDisposableService : public UObject, public IDisposable
+{
+    GENERATED_BODY()
+
+public:
+    void InitDependencies(UMockDisposeLog* InLog)
+    {
+        Log = InLog;
+    }
+
+    void Dispose() override
+    {
+        if (Log)
+        {
+            Log->Disposed.Add(this);
+        }
+    }
+
+    UPROPERTY()
+    TObjectPtr<UMockDisposeLog> Log;
+};
+
+/* Requests disposable service, so it is always created after it */
+UCLASS()
+class UNREALDITESTS_API UMockDisposableConsumer : public UObject, public IDisposable
+{
+    GENERATED_BODY()
+
+public:
+    void InitDependencies(UMockDisposeLog* InLog, UMockDisposableService* InService)
+    {
+        Log = InLog;
+        Service = InService;
+    }
+
+    void Dispose() override
+    {
+        Log->Disposed.Add(this);
+    }
+
+    UPROPERTY()
+    TObjectPtr<UMockDisposeLog> Log;
+
+    UPROPERTY()
+    TObjectPtr<UMockDisposableService> Service;
+};
@@ -0,0 +1,39 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "IReader.h"
+#include "MockReader.h"
+#include "MockClasses_InjectedFields.generated.h"
+
+/* Requests dependencies only through fields marked with Inject */
+UCLASS()
+class UNREALDITESTS_API UMockInjectedFields : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(meta = (Inject))
+    TObjectPtr<UMockReader> Reader;
+
+    UPROPERTY(meta = (Inject))
+    TScriptInterface<IReader> ReaderInterface;
+
+    UPROPERTY()
+    TObjectPtr<UMockReader> NotInjected;
+};
+
+/* Inherits injected fields and also has InitDependencies, which runs after fields are written */
+UCLASS()
+class UNREALDITESTS_API UMockInjectedFieldsWithInit : public UMockInjectedFields
+{
+    GENERATED_BODY()
+
+public:
+    void InitDependencies()
+    {
+        bReaderInjectedBeforeInit = Reader != nullptr;
+    }
+
+    bool bReaderInjectedBeforeInit = false;
+};
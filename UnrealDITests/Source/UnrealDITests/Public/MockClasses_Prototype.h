@@ -0,0 +1,42 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "IReader.h"
+#include "MockClasses_Prototype.generated.h"
+
+/* Keeps all state in UPROPERTY members and builds a lookup table in InitDependencies */
+UCLASS()
+class UNREALDITESTS_API UPrototypeMock : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    void InitDependencies(TScriptInterface<IReader>&& InReader)
+    {
+        Reader = MoveTemp(InReader);
+        ++InitCount;
+
+        LookupTable.SetNumUninitialized(256);
+        for (int32 i = 0; i < LookupTable.Num(); ++i)
+        {
+            LookupTable[i] = FMath::Square(i) % 97;
+        }
+    }
+
+    UPROPERTY()
+    TScriptInterface<IReader> Reader;
+
+    UPROPERTY()
+    TArray<int32> LookupTable;
+
+    UPROPERTY()
+    int32 InitCount = 0;
+};
+
+/* Same as UPrototypeMock, used to benchmark Transient lifetime */
+UCLASS()
+class UNREALDITESTS_API UTransientMock : public UPrototypeMock
+{
+    GENERATED_BODY()
+};
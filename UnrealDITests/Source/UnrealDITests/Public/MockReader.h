@@ -3,6 +3,7 @@
 #pragma once
 
 #include "IReader.h"
+#include "DI/IPerFrameResettable.h"
 #include "MockReader.generated.h"
 
 /* Implements IReader interface */
@@ -16,3 +17,17 @@ public:
 
     FString NextValue;
 };
+
+/* Implements IReader interface and may be reused between frames */
+UCLASS()
+class UNREALDITESTS_API UMockResettableReader : public UObject, public IReader, public IPerFrameResettable
+{
+    GENERATED_BODY()
+
+public:
+    FString Read() override { return NextValue; }
+    void ResetForNewFrame() override { ++ResetCount; }
+
+    FString NextValue;
+    int32 ResetCount = 0;
+};
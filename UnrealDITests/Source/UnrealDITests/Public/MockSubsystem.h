@@ -0,0 +1,17 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "IReader.h"
+#include "MockSubsystem.generated.h"
+
+/* World subsystem that implements IReader interface */
+UCLASS()
+class UNREALDITESTS_API UMockWorldSubsystem : public UWorldSubsystem, public IReader
+{
+    GENERATED_BODY()
+
+public:
+    FString Read() override { return TEXT("Subsystem"); }
+};